@@ -29,6 +29,15 @@ CPMDeclarePackage (googletest
                    GITHUB_REPOSITORY google/googletest
                    SYSTEM TRUE
                    OPTIONS "BUILD_GMOCK OFF" "INSTALL_GTEST OFF" "CMAKE_MESSAGE_LOG_LEVEL WARNING")
+# benchmark
+set (SHARG_BENCHMARK_VERSION 1.9.0)
+CPMDeclarePackage (benchmark
+                   NAME benchmark
+                   VERSION ${SHARG_BENCHMARK_VERSION}
+                   GITHUB_REPOSITORY google/benchmark
+                   SYSTEM TRUE
+                   OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_WERROR OFF"
+                           "CMAKE_MESSAGE_LOG_LEVEL WARNING")
 # doxygen-awesome
 set (SHARG_DOXYGEN_AWESOME_VERSION 2.3.4)
 CPMDeclarePackage (doxygen_awesome
@@ -28,6 +28,32 @@ enum class update_notifications
     off //!< Automatic update notifications should be disabled.
 };
 
+/*!\brief The quoting syntax of response files (`@file`), see sharg::parser::enable_response_files.
+ * \ingroup misc
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class response_file_syntax
+{
+    none,   //!< Arguments starting with `@` are not expanded.
+    gnu,    //!< Quoting as in GCC's response files: `'...'`, `"..."` and `\` escape any character.
+    windows //!< Quoting as in the Windows command line: `"..."`, `""` within quotes, and `\` only escapes `"`.
+};
+
+/*!\brief The result of a call to sharg::parser::parse(std::span<std::string_view const>, std::ostream &).
+ * \ingroup misc
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class parse_outcome
+{
+    parsed,            //!< The arguments were parsed into the option values.
+    help_printed,      //!< The (short or advanced) help page was printed.
+    version_printed,   //!< The version information was printed.
+    copyright_printed, //!< The copyright information was printed.
+    help_exported      //!< The help page was exported (`--export-help`).
+};
+
 /*!\brief Stores all parser related meta information of the sharg::parser.
  * \ingroup parser
  * \details
@@ -12,6 +12,7 @@
 #include <concepts>
 
 #include <sharg/enumeration_names.hpp>
+#include <sharg/from_string.hpp>
 
 namespace sharg
 {
@@ -80,15 +81,16 @@ concept ostreamable = requires (std::ostream & os, type & val)
  *
  * ### Requirements
  *
- * In order to model this concept, the type must either model sharg::istreamable and sharg::ostreamable or
- * model sharg::named_enumeration<option_type>.
+ * In order to model this concept, the type must either model sharg::istreamable and sharg::ostreamable,
+ * model sharg::from_string_parsable and sharg::ostreamable, or model sharg::named_enumeration<option_type>.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
  * \stableapi{Since version 1.0.}
  */
 template <typename option_type>
-concept parsable =
-    (sharg::istreamable<option_type> && sharg::ostreamable<option_type>) || named_enumeration<option_type>;
+concept parsable = (sharg::istreamable<option_type> && sharg::ostreamable<option_type>)
+                || (sharg::from_string_parsable<option_type> && sharg::ostreamable<option_type>)
+                || named_enumeration<option_type>;
 
 } // namespace sharg
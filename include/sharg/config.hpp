@@ -33,6 +33,7 @@ namespace sharg
  * | sharg::config::advanced             |           ✓          |      ✓      |              X            |
  * | sharg::config::hidden               |           ✓          |      ✓      |              X            |
  * | sharg::config::required             |           ✓          |      ✓      |             (✓)           |
+ * | sharg::config::list_separator       |          (✓)         |      X      |              X            |
  * | sharg::config::validator            |           ✓          |     (✓)     |              ✓            |
  *
  * \details
@@ -128,6 +129,23 @@ struct config
      */
     bool required{false};
 
+    /*!\brief A character that separates multiple values given to a single occurrence of a list option.
+     *
+     * By default (`'\0'`), a list option takes one value per occurrence, e.g. `-w 1 -w 2 -w 3`.
+     * If a separator is set, e.g. `','`, each value given on the command line is split at the separator and all
+     * elements are appended to the list, e.g. `-w 1,2,3` or `-w 1,2 -w 3`. Empty elements are parsed as empty strings,
+     * i.e. `-w 1,,3` is an error for a list of numbers.
+     *
+     * The validator is applied once to the complete list after all values have been parsed.
+     *
+     * \attention This parameter can only be set for options whose value is a container (see
+     *            sharg::parser::add_option). Otherwise, it will trigger a sharg::design_error.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    char list_separator{'\0'};
+
     /*!\brief A sharg::validator that verifies the value after parsing (callable).
      * \details
      * \stableapi{Since version 1.0.}
@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::deadline.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Runs file system calls that may block indefinitely, e.g. on a stale network mount, with a timeout.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * The timeout is set per thread by a sharg::detail::deadline::scope. Without a timeout, run() calls the function
+ * directly. Otherwise, run() passes the function to a worker thread of the calling thread and waits until the
+ * function returned or the timeout expired. In the latter case, the worker thread is abandoned, i.e. it exits as
+ * soon as the function returns, and run() throws a sharg::validation_timeout. The next call starts a new worker.
+ */
+class deadline
+{
+public:
+    //!\brief Sets the timeout of the calling thread while the object exists.
+    class scope
+    {
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        scope(scope const &) = delete;             //!< Deleted.
+        scope & operator=(scope const &) = delete; //!< Deleted.
+
+        //!\brief Sets the timeout of the calling thread to `timeout`; zero disables the timeout.
+        explicit scope(std::chrono::milliseconds const timeout) noexcept : previous{current_timeout}
+        {
+            current_timeout = timeout;
+        }
+
+        //!\brief Restores the previous timeout; stops the worker thread if there is no timeout anymore.
+        ~scope()
+        {
+            current_timeout = previous;
+
+            if (current_timeout.count() <= 0)
+                worker().abandon();
+        }
+        //!\}
+
+    private:
+        //!\brief The timeout before construction.
+        std::chrono::milliseconds previous;
+    };
+
+    //!\brief Returns the timeout of the calling thread; zero if there is none.
+    static std::chrono::milliseconds timeout() noexcept
+    {
+        return current_timeout;
+    }
+
+    /*!\brief Returns `function(path)`, which must not exceed the timeout of the calling thread.
+     * \param[in] path The path that `function` accesses; named in the exception.
+     * \param[in] function The function; must not refer to objects of the caller, which might be destroyed while the
+     *                     abandoned function still runs.
+     * \throws sharg::validation_timeout if the function does not return within the timeout.
+     * \throws Any exception thrown by `function`.
+     */
+    template <typename function_t>
+    static auto run(std::filesystem::path const & path, function_t function)
+    {
+        using result_t = std::invoke_result_t<function_t &, std::filesystem::path const &>;
+
+        if (current_timeout.count() <= 0)
+            return function(path);
+
+        auto task = std::make_shared<std::packaged_task<result_t()>>(
+            [function = std::move(function), path]() mutable
+            {
+                return function(path);
+            });
+        std::future<result_t> result = task->get_future();
+
+        worker().submit(
+            [task]()
+            {
+                (*task)();
+            });
+
+        if (result.wait_for(current_timeout) == std::future_status::timeout)
+        {
+            worker().abandon();
+            throw validation_timeout{"The file system did not respond within "
+                                     + std::to_string(current_timeout.count()) + " ms while checking \""
+                                     + path.string() + "\"!"};
+        }
+
+        return result.get();
+    }
+
+private:
+    //!\brief The timeout of the calling thread.
+    inline static thread_local std::chrono::milliseconds current_timeout{};
+
+    //!\brief The state shared by a worker thread and its owner.
+    struct worker_state
+    {
+        std::mutex mutex{};                  //!< Guards `task` and `stop`.
+        std::condition_variable condition{}; //!< Signals a new task or stopping.
+        std::function<void()> task{};        //!< The next task.
+        bool stop{false};                    //!< Whether the worker exits.
+    };
+
+    //!\brief Owns a worker thread; the thread is stopped on destruction.
+    class worker_handle
+    {
+    public:
+        /*!\name Constructors, destructor and assignment
+         * \{
+         */
+        worker_handle() = default;                                 //!< Defaulted.
+        worker_handle(worker_handle const &) = delete;             //!< Deleted.
+        worker_handle & operator=(worker_handle const &) = delete; //!< Deleted.
+
+        //!\brief Stops the worker thread.
+        ~worker_handle()
+        {
+            abandon();
+        }
+        //!\}
+
+        //!\brief Runs `task` on the worker thread, which is started if necessary.
+        void submit(std::function<void()> task)
+        {
+            if (state == nullptr)
+            {
+                state = std::make_shared<worker_state>();
+                std::thread{work, state}.detach();
+            }
+
+            {
+                std::lock_guard lock{state->mutex};
+                state->task = std::move(task);
+            }
+            state->condition.notify_one();
+        }
+
+        //!\brief Lets the worker thread exit once its current task returned.
+        void abandon()
+        {
+            if (state == nullptr)
+                return;
+
+            {
+                std::lock_guard lock{state->mutex};
+                state->stop = true;
+            }
+            state->condition.notify_one();
+            state.reset();
+        }
+
+    private:
+        //!\brief The state of the worker thread or `nullptr` if there is none.
+        std::shared_ptr<worker_state> state{};
+
+        //!\brief Runs the tasks of `state` until it is stopped.
+        static void work(std::shared_ptr<worker_state> const state)
+        {
+            std::unique_lock lock{state->mutex};
+
+            while (true)
+            {
+                state->condition.wait(lock,
+                                      [&state]()
+                                      {
+                                          return state->stop || state->task != nullptr;
+                                      });
+
+                if (state->stop)
+                    return;
+
+                std::function<void()> task = std::move(state->task);
+                state->task = nullptr;
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+    };
+
+    //!\brief Returns the worker of the calling thread.
+    static worker_handle & worker()
+    {
+        thread_local worker_handle handle{};
+        return handle;
+    }
+};
+
+} // namespace sharg::detail
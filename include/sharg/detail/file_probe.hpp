@@ -0,0 +1,675 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::file_probe.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/stat.h>
+#    include <sys/statvfs.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <sharg/detail/deadline.hpp>
+#include <sharg/detail/io_uring.hpp>
+#include <sharg/detail/safe_filesystem_entry.hpp>
+
+namespace sharg::detail
+{
+
+//!\brief The type of a file system entry as determined by sharg::detail::file_probe.
+//!\ingroup misc
+enum class file_type : uint8_t
+{
+    not_found, //!< The path does not exist.
+    regular,   //!< A regular file.
+    directory, //!< A directory.
+    other      //!< Any other file, e.g. a FIFO or a device.
+};
+
+//!\brief The free space of a file system as determined by sharg::detail::file_probe::space.
+//!\ingroup misc
+struct file_system_space
+{
+    std::filesystem::path path{};               //!< The existing path whose file system was queried.
+    uint64_t available_bytes{};                 //!< The number of bytes available to unprivileged users.
+    std::optional<uint64_t> available_inodes{}; //!< The number of available inodes if the file system reports it.
+};
+
+/*!\brief Checks the type and access permissions of paths with as few system calls as possible.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * On POSIX systems, the type of a path is determined by a single `statx` (Linux) or `stat` call, and access
+ * permissions are checked by a single `faccessat` call with `AT_EACCESS`, i.e. files are neither opened nor created.
+ * Whether a new file can be created in a directory is checked by opening an unnamed temporary file (`O_TMPFILE`)
+ * in the directory, which never appears in the directory; if the file system does not support `O_TMPFILE`,
+ * the write permissions of the directory are checked instead. On other systems, the checks use std::filesystem and
+ * file streams.
+ *
+ * Many paths can be probed at once by a sharg::detail::file_probe::batch, which uses io_uring on Linux.
+ *
+ * If the calling thread has a timeout, see sharg::detail::deadline, the system calls of type(), is_readable(),
+ * is_writable(), prefetch(), space() and reserve() must finish in time; otherwise, a sharg::validation_timeout is
+ * thrown.
+ *
+ * All system calls are counted, see sharg::detail::file_probe::syscall_count.
+ */
+class file_probe
+{
+public:
+    class batch;
+
+    /*!\brief Whether sharg::detail::file_probe::batch may use io_uring if it is available.
+     * \details
+     * Set to `false` to always probe paths synchronously, e.g. to compare both. The validators only create a batch if
+     * io_uring was requested, see sharg::input_file_validator::use_io_uring.
+     */
+    inline static std::atomic<bool> use_io_uring{true};
+
+    /*!\brief Returns the type of `path`; symbolic links are followed.
+     * \param[in] path The path.
+     * \throws std::filesystem::filesystem_error if the type cannot be determined, e.g. due to missing permissions.
+     */
+    static file_type type(std::filesystem::path const & path);
+
+    /*!\brief Whether the existing file or directory `path` can be read.
+     * \param[in] path The path.
+     * \param[in] path_type The type of `path`.
+     */
+    static bool is_readable(std::filesystem::path const & path, file_type const path_type);
+
+    /*!\brief Whether `path` can be written, i.e. opened for writing if it exists or created otherwise.
+     * \param[in] path The path.
+     * \param[in] path_type The type of `path`; must not be sharg::detail::file_type::directory.
+     */
+    static bool is_writable(std::filesystem::path const & path, file_type const path_type)
+    {
+        return deadline::run(path,
+                             [path_type](std::filesystem::path const & target)
+                             {
+                                 return query_writable(target, path_type);
+                             });
+    }
+
+    /*!\brief Asks the operating system to read the beginning of the file `path` into the page cache.
+     * \param[in] path The path of a regular file.
+     * \param[in] use_readahead Whether to use `readahead` instead of `posix_fadvise(POSIX_FADV_WILLNEED)`; only
+     *                          supported on Linux.
+     * \param[in] claim Called with the size of the file; returns the number of bytes to read.
+     *
+     * \details
+     *
+     * The file is read in the background, i.e. the call does not wait for the data. Errors are ignored. On systems
+     * without `posix_fadvise`, nothing is read.
+     *
+     * Opening the file is subject to the timeout of sharg::detail::deadline. Hence, `claim` is copied and must not
+     * refer to objects of the caller.
+     */
+    template <typename claim_t>
+    static void prefetch(std::filesystem::path const & path, bool const use_readahead, claim_t claim)
+    {
+        deadline::run(path,
+                      [use_readahead, claim = std::move(claim)](std::filesystem::path const & target)
+                      {
+                          query_prefetch(target, use_readahead, claim);
+                      });
+    }
+
+    /*!\brief Returns the free space of the file system containing `path` or, if `path` does not exist, its nearest
+     *        existing ancestor.
+     * \param[in] path The path.
+     * \throws std::filesystem::filesystem_error if the free space cannot be determined.
+     */
+    static file_system_space space(std::filesystem::path const & path)
+    {
+        return deadline::run(path, query_space);
+    }
+
+    /*!\brief Allocates `bytes` bytes of disk space for the file `path`, which is created if it does not exist.
+     * \param[in] path The path.
+     * \param[in] bytes The number of bytes.
+     * \returns `0` on success, or the error number; `EOPNOTSUPP` if the file system or the system does not support
+     *          allocating space.
+     *
+     * \details
+     *
+     * On Linux, the space is allocated via `fallocate` with `FALLOC_FL_KEEP_SIZE`, i.e. the size of the file does not
+     * change. If the file is truncated, e.g. by opening it with `std::ofstream`, the space is released.
+     */
+    static int reserve(std::filesystem::path const & path, uint64_t const bytes)
+    {
+        return deadline::run(path,
+                             [bytes](std::filesystem::path const & target)
+                             {
+                                 return allocate(target, bytes);
+                             });
+    }
+
+    //!\brief Returns the number of system calls issued since the program started or the last reset.
+    static size_t syscall_count() noexcept
+    {
+        return syscalls.load(std::memory_order_relaxed);
+    }
+
+    //!\brief Resets the number of system calls to 0.
+    static void reset_syscall_count() noexcept
+    {
+        syscalls.store(0u, std::memory_order_relaxed);
+    }
+
+private:
+    //!\brief The number of system calls.
+    inline static std::atomic<size_t> syscalls{};
+
+    //!\brief Adds `count` to the number of system calls.
+    static void count_syscalls(size_t const count) noexcept
+    {
+        syscalls.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /*!\name Queries
+     * \brief The system calls of the public functions, which run them with the timeout of sharg::detail::deadline.
+     * \{
+     */
+    static file_type query_type(std::filesystem::path const & path);
+    static bool query_readable(std::filesystem::path const & path, file_type const path_type);
+    static bool query_writable(std::filesystem::path const & path, file_type const path_type);
+    static file_system_space query_space(std::filesystem::path const & path);
+    static int allocate(std::filesystem::path const & path, uint64_t const bytes);
+    //!\}
+
+    //!\brief The system calls of prefetch().
+    template <typename claim_t>
+    static void query_prefetch([[maybe_unused]] std::filesystem::path const & path,
+                               [[maybe_unused]] bool const use_readahead,
+                               [[maybe_unused]] claim_t const & claim)
+    {
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+        count_syscalls(1u);
+        int const fd = ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC);
+
+        if (fd == -1)
+            return;
+
+        struct stat status
+        {};
+        count_syscalls(1u);
+        uint64_t const length = ::fstat(fd, &status) == 0 ? claim(static_cast<uint64_t>(status.st_size)) : 0u;
+
+        if (length > 0u)
+        {
+            count_syscalls(1u);
+#    ifdef __linux__
+            if (use_readahead)
+                ::readahead(fd, 0, length);
+            else
+#    endif
+                ::posix_fadvise(fd, 0, static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+        }
+
+        count_syscalls(1u);
+        ::close(fd);
+#endif
+    }
+
+#ifndef _WIN32
+    //!\brief Checks the permissions `mode` of `path` for the effective user.
+    static bool access(std::filesystem::path const & path, int const mode)
+    {
+        count_syscalls(1u);
+        return ::faccessat(AT_FDCWD, path.c_str(), mode, AT_EACCESS) == 0;
+    }
+
+    //!\brief Returns the type of a path with the given `mode`.
+    static file_type type_of(mode_t const mode) noexcept
+    {
+        if (S_ISREG(mode))
+            return file_type::regular;
+        else if (S_ISDIR(mode))
+            return file_type::directory;
+        else
+            return file_type::other;
+    }
+
+    /*!\brief Returns the type of `path` if determining it failed with `error`.
+     * \throws std::filesystem::filesystem_error unless `error` means that `path` does not exist.
+     */
+    static file_type type_of(std::filesystem::path const & path, int const error)
+    {
+        if (error == ENOENT || error == ENOTDIR)
+            return file_type::not_found;
+
+        throw std::filesystem::filesystem_error{"Cannot determine the file type",
+                                                path,
+                                                std::error_code{error, std::system_category()}};
+    }
+#endif
+};
+
+/*!\brief Probes the type and readability of many paths at once.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * On Linux, the constructor submits `statx` for all paths, and `openat` with `O_RDONLY` for all regular files and
+ * directories, as io_uring requests in batches of sharg::detail::file_probe::batch::queue_depth paths. Opened files
+ * are closed right away, again by io_uring requests. Hence, probing many paths takes a few system calls per batch
+ * instead of two per path.
+ *
+ * While the object exists, sharg::detail::file_probe::type and sharg::detail::file_probe::is_readable return the
+ * probed results for these paths on the constructing thread, i.e. they return and throw exactly what the synchronous
+ * system calls would have returned and thrown. Results that may differ, e.g. because `openat` failed due to the limit
+ * of open files, are probed synchronously instead.
+ *
+ * If io_uring is unavailable, e.g. on other systems, if it is disabled, or if the kernel does not support the
+ * requests, nothing is probed and is_complete() returns `false`. The same holds if the constructing thread has a
+ * timeout (sharg::detail::deadline).
+ */
+class file_probe::batch
+{
+public:
+    //!\brief The maximal number of paths that are probed by one batch of requests.
+    static constexpr unsigned queue_depth{256u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    batch(batch const &) = delete;             //!< Deleted.
+    batch & operator=(batch const &) = delete; //!< Deleted.
+
+    /*!\brief Probes `paths`.
+     * \param[in] paths The paths; must outlive the object.
+     */
+    explicit batch([[maybe_unused]] std::span<std::filesystem::path const> const paths)
+    {
+#if SHARG_HAS_IO_URING
+        // Waiting for io_uring requests cannot be interrupted by a timeout.
+        if (use_io_uring.load(std::memory_order_relaxed) && deadline::timeout().count() == 0)
+        {
+            size_t queue_syscalls{};
+            {
+                io_uring_queue queue{queue_depth, queue_syscalls};
+                complete = queue.is_open() && queue.supports({IORING_OP_STATX, IORING_OP_OPENAT, IORING_OP_CLOSE})
+                        && probe(paths, queue);
+            } // Closes the queue.
+            count_syscalls(queue_syscalls);
+        }
+
+        if (complete)
+        {
+            previous = active;
+            active = this;
+        }
+        else
+        {
+            probed_paths.clear();
+        }
+#endif
+    }
+
+    //!\brief The results of the batch are no longer used.
+    ~batch()
+    {
+        if (complete)
+            active = previous;
+    }
+    //!\}
+
+    //!\brief Whether all paths were probed.
+    bool is_complete() const noexcept
+    {
+        return complete;
+    }
+
+private:
+    //!\brief Befriended to look up the results.
+    friend file_probe;
+
+    //!\brief The result of probing a path.
+    struct result
+    {
+        bool type_known{false};               //!< Whether `type_error` and `type` are set.
+        bool readability_known{false};        //!< Whether `readable` is set.
+        bool readable{false};                 //!< Whether the path can be read.
+        file_type type{file_type::not_found}; //!< The type of the path if `type_error` is 0.
+        int type_error{};                     //!< The error of `statx` or 0.
+    };
+
+    //!\brief The results by path.
+    std::unordered_map<std::basic_string_view<std::filesystem::path::value_type>, result> probed_paths{};
+    //!\brief Whether all paths were probed.
+    bool complete{false};
+    //!\brief The batch that was active on construction.
+    batch const * previous{nullptr};
+
+    //!\brief The batch whose results are used on this thread.
+    inline static thread_local batch const * active{nullptr};
+
+    //!\brief Returns the result of `path` in the active batch or `nullptr`.
+    static result const * find(std::filesystem::path const & path) noexcept
+    {
+        if (active == nullptr)
+            return nullptr;
+
+        auto const it = active->probed_paths.find(path.native());
+        return it == active->probed_paths.end() ? nullptr : &it->second;
+    }
+
+#if SHARG_HAS_IO_URING
+    /*!\brief Probes `paths` with `queue`.
+     * \returns `false` if submitting the requests failed.
+     */
+    bool probe(std::span<std::filesystem::path const> const paths, io_uring_queue & queue)
+    {
+        size_t const chunk_size = std::min<size_t>(queue.capacity(), queue_depth);
+        std::vector<struct statx> statx_buffers(chunk_size);
+        std::vector<decltype(probed_paths)::value_type *> chunk{};
+        std::vector<int> open_files{};
+        chunk.reserve(chunk_size);
+        open_files.reserve(chunk_size);
+        probed_paths.reserve(paths.size());
+
+        for (size_t next = 0; next < paths.size();)
+        {
+            // 1. statx for the next distinct paths.
+            chunk.clear();
+
+            for (; next < paths.size() && chunk.size() < chunk_size; ++next)
+            {
+                auto [it, inserted] = probed_paths.try_emplace(paths[next].native());
+
+                if (!inserted)
+                    continue;
+
+                io_uring_sqe * const sqe = queue.next_sqe();
+                sqe->opcode = IORING_OP_STATX;
+                sqe->fd = AT_FDCWD;
+                sqe->addr = reinterpret_cast<uintptr_t>(paths[next].c_str());
+                sqe->len = STATX_TYPE;
+                sqe->off = reinterpret_cast<uintptr_t>(&statx_buffers[chunk.size()]);
+                sqe->statx_flags = AT_STATX_SYNC_AS_STAT;
+                sqe->user_data = chunk.size();
+                chunk.push_back(&*it);
+            }
+
+            if (queue.submit_and_wait() != 0)
+                return false;
+
+            queue.for_each_completion(
+                [&](uint64_t const index, int const status)
+                {
+                    result & probed = chunk[index]->second;
+                    // Retry errors that synchronous calls do not return.
+                    probed.type_known = status != -EAGAIN && status != -EINTR && status != -ECANCELED;
+                    probed.type_error = status < 0 ? -status : 0;
+
+                    if (status == 0)
+                        probed.type = type_of(statx_buffers[index].stx_mode);
+                });
+
+            // 2. openat for regular files and directories.
+            for (size_t i = 0; i < chunk.size(); ++i)
+            {
+                result const & probed = chunk[i]->second;
+
+                if (!probed.type_known || (probed.type != file_type::regular && probed.type != file_type::directory))
+                    continue;
+
+                io_uring_sqe * const sqe = queue.next_sqe();
+                sqe->opcode = IORING_OP_OPENAT;
+                sqe->fd = AT_FDCWD;
+                sqe->addr = reinterpret_cast<uintptr_t>(chunk[i]->first.data()); // Views a null-terminated path.
+                sqe->open_flags = O_RDONLY | O_NONBLOCK | O_NOCTTY | O_CLOEXEC;
+                sqe->user_data = i;
+            }
+
+            int const open_error = queue.submit_and_wait();
+            queue.for_each_completion(
+                [&](uint64_t const index, int const status)
+                {
+                    result & probed = chunk[index]->second;
+                    // Only a denied access means that the path cannot be read.
+                    probed.readability_known = status >= 0 || status == -EACCES || status == -EPERM;
+                    probed.readable = status >= 0;
+
+                    if (status >= 0)
+                        open_files.push_back(status);
+                });
+
+            // 3. close the opened files.
+            for (size_t i = 0; open_error == 0 && i < open_files.size(); ++i)
+            {
+                io_uring_sqe * const sqe = queue.next_sqe();
+                sqe->opcode = IORING_OP_CLOSE;
+                sqe->fd = open_files[i];
+                sqe->user_data = i;
+            }
+
+            int const close_error = open_error == 0 ? queue.submit_and_wait() : open_error;
+            queue.for_each_completion(
+                [&](uint64_t const index, int)
+                {
+                    open_files[index] = -1;
+                });
+
+            // Files that were not closed by requests are closed synchronously.
+            for (int const fd : open_files)
+            {
+                if (fd >= 0)
+                {
+                    count_syscalls(1u);
+                    ::close(fd);
+                }
+            }
+
+            open_files.clear();
+
+            if (close_error != 0)
+                return false;
+        }
+
+        return true;
+    }
+#endif
+};
+
+inline file_type file_probe::type(std::filesystem::path const & path)
+{
+#ifndef _WIN32
+    if (batch::result const * probed = batch::find(path); probed != nullptr && probed->type_known)
+        return probed->type_error == 0 ? probed->type : type_of(path, probed->type_error);
+#endif
+
+    return deadline::run(path, query_type);
+}
+
+inline file_type file_probe::query_type(std::filesystem::path const & path)
+{
+#ifndef _WIN32
+    count_syscalls(1u);
+#    if defined(__linux__) && defined(STATX_TYPE)
+    struct statx status
+    {};
+    if (::statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT, STATX_TYPE, &status) == -1)
+        return type_of(path, errno);
+
+    return type_of(status.stx_mode);
+#    else
+    struct stat status
+    {};
+    if (::stat(path.c_str(), &status) == -1)
+        return type_of(path, errno);
+
+    return type_of(status.st_mode);
+#    endif
+#else
+    count_syscalls(1u);
+    std::filesystem::file_status const status = std::filesystem::status(path);
+
+    if (!std::filesystem::exists(status))
+        return file_type::not_found;
+    else if (std::filesystem::is_regular_file(status))
+        return file_type::regular;
+    else if (std::filesystem::is_directory(status))
+        return file_type::directory;
+    else
+        return file_type::other;
+#endif
+}
+
+inline bool file_probe::is_readable(std::filesystem::path const & path, [[maybe_unused]] file_type const path_type)
+{
+#ifndef _WIN32
+    if (batch::result const * probed = batch::find(path); probed != nullptr && probed->readability_known)
+        return probed->readable;
+#endif
+
+    return deadline::run(path,
+                         [path_type](std::filesystem::path const & target)
+                         {
+                             return query_readable(target, path_type);
+                         });
+}
+
+inline bool file_probe::query_readable(std::filesystem::path const & path, [[maybe_unused]] file_type const path_type)
+{
+#ifndef _WIN32
+    return access(path, R_OK);
+#else
+    count_syscalls(2u); // open and close
+    if (path_type == file_type::directory)
+    {
+        std::error_code error{};
+        std::filesystem::directory_iterator{path, error};
+        return !error;
+    }
+
+    std::ifstream file{path};
+    return file.is_open() && file.good();
+#endif
+}
+
+inline bool file_probe::query_writable(std::filesystem::path const & path, [[maybe_unused]] file_type const path_type)
+{
+#ifndef _WIN32
+    if (path_type != file_type::not_found)
+        return access(path, W_OK);
+
+    std::filesystem::path const parent = path.has_parent_path() ? path.parent_path() : ".";
+#    ifdef O_TMPFILE
+    count_syscalls(1u);
+    int const fd = ::open(parent.c_str(), O_TMPFILE | O_WRONLY | O_CLOEXEC, S_IRUSR | S_IWUSR);
+
+    if (fd != -1)
+    {
+        count_syscalls(1u);
+        ::close(fd);
+        return true;
+    }
+
+    // Otherwise, the file system or the kernel does not support O_TMPFILE.
+    if (errno != EOPNOTSUPP && errno != EISDIR && errno != EINVAL)
+        return false;
+#    endif
+    return access(parent, W_OK | X_OK);
+#else
+    count_syscalls(3u); // open, close and remove
+    std::ofstream file{path};
+    safe_filesystem_entry file_guard{path};
+
+    bool const is_open = file.is_open();
+    bool const is_good = file.good();
+    file.close();
+
+    if (!is_good || !is_open)
+        return false;
+
+    file_guard.remove();
+    return true;
+#endif
+}
+
+inline file_system_space file_probe::query_space(std::filesystem::path const & path)
+{
+    file_system_space result{.path = path.empty() ? "." : path};
+
+    for (;;)
+    {
+        count_syscalls(1u);
+#ifndef _WIN32
+        struct statvfs status
+        {};
+        int const error = ::statvfs(result.path.c_str(), &status) == 0 ? 0 : errno;
+
+        if (error == 0)
+        {
+            result.available_bytes = static_cast<uint64_t>(status.f_bavail) * status.f_frsize;
+
+            if (status.f_files > 0u) // Some file systems do not limit the number of inodes.
+                result.available_inodes = status.f_favail;
+
+            return result;
+        }
+#else
+        std::error_code error_code{};
+        std::filesystem::space_info const info = std::filesystem::space(result.path, error_code);
+        int const error = error_code.value();
+
+        if (!error_code)
+        {
+            result.available_bytes = info.available;
+            return result;
+        }
+#endif
+        std::filesystem::path parent = result.path.has_parent_path() ? result.path.parent_path() : ".";
+
+        if ((error != ENOENT && error != ENOTDIR) || parent == result.path)
+        {
+            throw std::filesystem::filesystem_error{"Cannot determine the free space",
+                                                    result.path,
+                                                    std::error_code{error, std::system_category()}};
+        }
+
+        result.path = std::move(parent);
+    }
+}
+
+inline int file_probe::allocate([[maybe_unused]] std::filesystem::path const & path,
+                                 [[maybe_unused]] uint64_t const bytes)
+{
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+    count_syscalls(1u);
+    int const fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_NOCTTY | O_CLOEXEC, 0666);
+
+    if (fd == -1)
+        return errno;
+
+    count_syscalls(2u); // fallocate and close
+    int const error = ::fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(bytes)) == 0 ? 0 : errno;
+    ::close(fd);
+    return error;
+#else
+    return EOPNOTSUPP;
+#endif
+}
+
+} // namespace sharg::detail
@@ -13,6 +13,7 @@
 #include <sharg/auxiliary.hpp>
 #include <sharg/config.hpp>
 #include <sharg/detail/concept.hpp>
+#include <sharg/detail/output_buffer.hpp>
 #include <sharg/detail/type_name_as_string.hpp>
 #include <sharg/validators.hpp>
 
@@ -176,7 +177,7 @@ protected:
             tmp.append({'-', *it, ',', ' '});
 
         tmp.erase(tmp.find_last_of(',')); // remove last ', '
-        tmp.append({'a', 'n', 'd', ' ', '-', flag_cluster[flag_cluster.size() - 1]});
+        tmp.append({' ', 'a', 'n', 'd', ' ', '-', flag_cluster[flag_cluster.size() - 1]});
 
         return tmp;
     }
@@ -198,8 +199,7 @@ protected:
     {
         static_assert(std::same_as<option_type, default_type> || std::same_as<default_type, std::string>);
 
-        std::stringstream message{};
-        message << " Default: ";
+        std::string message{" Default: "};
 
         if constexpr (detail::is_container_option<option_type>)
         {
@@ -211,11 +211,11 @@ protected:
                                                   {
                                                       return std::quoted(val);
                                                   });
-                message << detail::to_string(view);
+                message += detail::to_string(view);
             }
             else // Otherwise we just print the list or the default_message without quotes.
             {
-                message << detail::to_string(value);
+                message += detail::to_string(value);
             }
         }
         else
@@ -229,17 +229,17 @@ protected:
             static constexpr bool needs_string_quote = option_is_string || (option_is_path && value_is_string);
 
             if constexpr (needs_string_quote)
-                message << std::quoted(value);
+                message += detail::to_string(std::quoted(value));
             else
-                message << detail::to_string(value);
+                message += detail::to_string(value);
         }
 
-        return message.str();
+        return message;
     }
 };
 
 /*!\brief The format that contains all helper functions needed in all formats for
- *        printing the interface description of the application (to std::cout).
+ *        printing the interface description of the application (to std::cout by default).
  * \ingroup parser
  * \remark For a complete overview, take a look at \ref parser
  */
@@ -286,6 +286,9 @@ public:
         else
             info += get_default_message(value, config.default_message);
 
+        if (config.list_separator != '\0')
+            info += ". Multiple values can be separated by '" + std::string(1, config.list_separator) + "'";
+
         if (auto const & validator_message = config.validator.get_help_page_message(); !validator_message.empty())
             info += ". " + validator_message;
 
@@ -355,7 +358,7 @@ public:
             });
     }
 
-    /*!\brief Initiates the printing of the help page to std::cout.
+    /*!\brief Initiates the printing of the help page to sharg::detail::format_help_base::stream.
      * \param[in] parser_meta The meta information that are needed for a detailed help page.
      */
     void parse(parser_meta_data & parser_meta)
@@ -433,6 +436,8 @@ public:
         print_legal();
 
         derived_t().print_footer();
+
+        page.write_to(*stream);
     }
 
     /*!\brief Adds a print_section call to parser_set_up_calls.
@@ -507,6 +512,12 @@ public:
      */
     parser_meta_data meta;
 
+    //!\brief The stream that the help page is printed to. Set by the sharg::parser before calling parse().
+    std::ostream * stream{&std::cout};
+
+    //!\brief The help page is rendered into this buffer and written to `stream` at the end of parse().
+    output_buffer page{};
+
     //!\brief Befriend the derived type so it can access private functions.
     friend derived_type;
 
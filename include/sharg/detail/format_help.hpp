@@ -113,17 +113,15 @@ protected:
     //!\brief Prints a help page header to std::cout.
     void print_header()
     {
-        std::ostream_iterator<char> out(std::cout);
-
-        std::cout << meta.app_name;
+        page << meta.app_name;
         if (!empty(meta.short_description))
-            std::cout << " - " << meta.short_description;
+            page << " - " << meta.short_description;
 
-        std::cout << "\n";
+        page << "\n";
         unsigned len =
             text_width(meta.app_name) + (empty(meta.short_description) ? 0 : 3) + text_width(meta.short_description);
-        std::fill_n(out, len, '=');
-        std::cout << '\n';
+        page.append(len, '=');
+        page << '\n';
     }
 
     /*!\brief Prints a help page section to std::cout.
@@ -131,16 +129,10 @@ protected:
      */
     void print_section(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << '\n' << to_text("\\fB");
-        std::transform(title.begin(),
-                       title.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << to_text("\\fP") << '\n';
+        page << '\n' << to_text("\\fB");
+        for (unsigned char const c : title)
+            page << static_cast<char>(std::toupper(c));
+        page << to_text("\\fP") << '\n';
         prev_was_paragraph = false;
     }
 
@@ -149,10 +141,9 @@ protected:
      */
     void print_subsection(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << '\n';
-        std::fill_n(out, layout.leftPadding / 2, ' ');
-        std::cout << in_bold(title) << '\n';
+        page << '\n';
+        page.append(layout.leftPadding / 2, ' ');
+        page << in_bold(title) << '\n';
         prev_was_paragraph = false;
     }
 
@@ -164,10 +155,9 @@ protected:
     void print_line(std::string const & text, bool const line_is_paragraph)
     {
         if (prev_was_paragraph)
-            std::cout << '\n';
+            page << '\n';
 
-        std::ostream_iterator<char> out(std::cout);
-        std::fill_n(out, layout.leftPadding, ' ');
+        page.append(layout.leftPadding, ' ');
         print_text(text, layout.leftPadding);
         prev_was_paragraph = line_is_paragraph;
     }
@@ -189,20 +179,18 @@ protected:
     void print_list_item(std::string const & term, std::string const & desc)
     {
         if (prev_was_paragraph)
-            std::cout << '\n';
-
-        std::ostream_iterator<char> out(std::cout);
+            page << '\n';
 
         // Print term.
-        std::fill_n(out, layout.leftPadding, ' ');
-        std::cout << to_text(term);
+        page.append(layout.leftPadding, ' ');
+        page << to_text(term);
         unsigned pos = layout.leftPadding + term.size();
         if (pos + layout.centerPadding > layout.rightColumnTab)
         {
-            std::cout << '\n';
+            page << '\n';
             pos = 0;
         }
-        std::fill_n(out, layout.rightColumnTab - pos, ' ');
+        page.append(layout.rightColumnTab - pos, ' ');
         print_text(desc, layout.rightColumnTab);
 
         prev_was_paragraph = false;
@@ -217,9 +205,10 @@ protected:
     /*!\brief Formats text for pretty command line printing.
      * \param[in] str The input string to format for correct command line printing.
      */
-    std::string to_text(std::string const & str)
+    std::string to_text(std::string_view const str)
     {
         std::string result;
+        result.reserve(str.size());
 
         for (auto it = str.begin(); it != str.end(); ++it)
         {
@@ -238,17 +227,17 @@ protected:
                     assert(it != str.end());
                     if (*it == 'I')
                     {
-                        if (stdout_is_terminal())
+                        if (is_terminal)
                             result.append("\033[4m");
                     }
                     else if (*it == 'B')
                     {
-                        if (stdout_is_terminal())
+                        if (is_terminal)
                             result.append("\033[1m");
                     }
                     else if (*it == 'P')
                     {
-                        if (stdout_is_terminal())
+                        if (is_terminal)
                             result.append("\033[0m");
                     }
                     else
@@ -276,7 +265,7 @@ protected:
      * \param[in] text The string to compute the width for on the command line.
      * /detail Note: "\-" has length 1, "\fI", "\fB", "\fP" have length 0.
      */
-    unsigned text_width(std::string const & text)
+    unsigned text_width(std::string_view const text)
     {
         unsigned result = 0;
 
@@ -323,54 +312,51 @@ protected:
     /*!\brief Prints text with correct line wrapping to the command line (std::cout).
      * \param[in] text   The string to print on the command line.
      * \param[in] tab    The position offset (indentation) to start printing at.
+     * \details The text is split at whitespace; each word is measured once.
      */
-    void print_text(std::string const & text, unsigned const tab)
+    void print_text(std::string_view const text, unsigned const tab)
     {
+        static constexpr std::string_view whitespace{" \t\n\v\f\r"};
         unsigned pos = tab;
-        std::ostream_iterator<char> out(std::cout);
-
-        // Tokenize the text.
-        std::istringstream iss(text.c_str());
-        std::vector<std::string> tokens{std::istream_iterator<std::string>(iss), std::istream_iterator<std::string>()};
+        bool is_first_word{true};
 
-        // Print the text.
-        assert(pos <= tab);
-        std::fill_n(out, tab - pos, ' '); // go to tab
-
-        pos = tab;
-        for (auto it = tokens.begin(); it != tokens.end(); ++it)
+        for (size_t begin = text.find_first_not_of(whitespace); begin != std::string_view::npos;
+             begin = text.find_first_not_of(whitespace, begin))
         {
-            if (it == tokens.begin())
+            size_t const end = std::min(text.find_first_of(whitespace, begin), text.size());
+            std::string_view const word = text.substr(begin, end - begin);
+            unsigned const width = text_width(word);
+            begin = end;
+
+            if (is_first_word)
             {
-                std::cout << to_text(*it);
-                pos += text_width(*it);
+                is_first_word = false;
+                page << to_text(word);
+                pos += width;
                 if (pos > layout.screenWidth)
                 {
-                    std::cout << '\n';
-                    std::fill_n(out, tab, ' ');
+                    page << '\n';
+                    page.append(tab, ' ');
                     pos = tab;
                 }
             }
+            else if (pos + 1 + width > layout.screenWidth)
+            {
+                // Would go over screen with next, print current word on next line.
+                page << '\n';
+                page.append(tab, ' ');
+                page << to_text(word);
+                pos = tab + width;
+            }
             else
             {
-                if (pos + 1 + text_width(*it) > layout.screenWidth)
-                {
-                    // Would go over screen with next, print current word on next line.
-                    std::cout << '\n';
-                    fill_n(out, tab, ' ');
-                    std::cout << to_text(*it);
-                    pos = tab + text_width(*it);
-                }
-                else
-                {
-                    std::cout << ' ';
-                    std::cout << to_text(*it);
-                    pos += text_width(*it) + 1;
-                }
+                page << ' ' << to_text(word);
+                pos += width + 1;
             }
         }
-        if (!empty(tokens))
-            std::cout << '\n';
+
+        if (!is_first_word)
+            page << '\n';
     }
 
     /*!\brief Format string in bold.
@@ -385,6 +371,9 @@ protected:
     //!\brief Needed for correct formatting while calling different print functions.
     bool prev_was_paragraph{false};
 
+    //!\brief Whether the standard output is a terminal, i.e. whether to use escape codes for bold text etc.
+    bool is_terminal{stdout_is_terminal()};
+
     //!\brief Befriend sharg::detail::test_accessor to grant access to layout.
     friend struct ::sharg::detail::test_accessor;
 
@@ -419,6 +408,8 @@ public:
             print_synopsis();
 
         print_line("Try -h or --help for more information.\n", true);
+
+        page.write_to(*stream);
     }
 };
 
@@ -445,6 +436,8 @@ public:
 
         print_header();
         print_version();
+
+        page.write_to(*stream);
     }
 };
 
@@ -497,28 +490,30 @@ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
 OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 DAMAGE.)"};
 
-        std::cout << std::string(80, '=') << "\n"
-                  << in_bold("Copyright information for " + meta.app_name + ":\n") << std::string(80, '-') << '\n';
+        page << std::string(80, '=') << "\n"
+             << in_bold("Copyright information for " + meta.app_name + ":\n") << std::string(80, '-') << '\n';
 
         if (!empty(meta.long_copyright))
         {
-            std::cout << to_text("\\fP") << meta.long_copyright << "\n";
+            page << to_text("\\fP") << meta.long_copyright << "\n";
         }
         else if (!empty(meta.short_copyright))
         {
-            std::cout << in_bold(meta.app_name + " full copyright information not available. "
-                                 + "Displaying short copyright information instead:\n")
-                      << meta.short_copyright << "\n";
+            page << in_bold(meta.app_name + " full copyright information not available. "
+                            + "Displaying short copyright information instead:\n")
+                 << meta.short_copyright << "\n";
         }
         else
         {
-            std::cout << to_text("\\fP") << meta.app_name << " copyright information not available.\n";
+            page << to_text("\\fP") << meta.app_name << " copyright information not available.\n";
         }
 
-        std::cout << std::string(80, '=') << '\n'
-                  << in_bold("This program contains SeqAn code licensed under the following terms:\n")
-                  << std::string(80, '-') << '\n'
-                  << seqan_license << '\n';
+        page << std::string(80, '=') << '\n'
+             << in_bold("This program contains SeqAn code licensed under the following terms:\n")
+             << std::string(80, '-') << '\n'
+             << seqan_license << '\n';
+
+        page.write_to(*stream);
     }
 };
 
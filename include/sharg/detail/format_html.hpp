@@ -58,7 +58,7 @@ private:
     {
         if (is_dl)
         {
-            std::cout << "</dl>\n";
+            page << "</dl>\n";
             is_dl = false;
         }
     }
@@ -68,7 +68,7 @@ private:
     {
         if (is_p)
         {
-            std::cout << "</p>\n";
+            page << "</p>\n";
             is_p = false;
         }
     }
@@ -77,18 +77,18 @@ private:
     void print_header()
     {
         // Print HTML boilerplate header.
-        std::cout << "<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\" "
-                  << "http://www.w3.org/TR/html4/strict.dtd\">\n"
-                  << "<html lang=\"en\">\n"
-                  << "<head>\n"
-                  << "<meta http-equiv=\"content-type\" content=\"text/html; charset=utf-8\">\n"
-                  << "<title>" << escape_special_xml_chars(meta.app_name) << " &mdash; "
-                  << escape_special_xml_chars(meta.short_description) << "</title>\n"
-                  << "</head>\n"
-                  << "<body>\n";
-
-        std::cout << "<h1>" << to_html(meta.app_name) << "</h1>\n"
-                  << "<div>" << to_html(meta.short_description) << "</div>\n";
+        page << "<!DOCTYPE html PUBLIC \"-//W3C//DTD HTML 4.01//EN\" "
+             << "http://www.w3.org/TR/html4/strict.dtd\">\n"
+             << "<html lang=\"en\">\n"
+             << "<head>\n"
+             << "<meta http-equiv=\"content-type\" content=\"text/html; charset=utf-8\">\n"
+             << "<title>" << escape_special_xml_chars(meta.app_name) << " &mdash; "
+             << escape_special_xml_chars(meta.short_description) << "</title>\n"
+             << "</head>\n"
+             << "<body>\n";
+
+        page << "<h1>" << to_html(meta.app_name) << "</h1>\n"
+             << "<div>" << to_html(meta.short_description) << "</div>\n";
     }
 
     /*!\brief Prints a section title in HTML format to std::cout.
@@ -99,7 +99,7 @@ private:
         // SEQAN_ASSERT_NOT_MSG(isDl && isP, "Current <dl> and <p> are mutually exclusive.");
         maybe_close_list();
         maybe_close_paragraph();
-        std::cout << "<h2>" << to_html(title) << "</h2>\n";
+        page << "<h2>" << to_html(title) << "</h2>\n";
     }
 
     /*!\brief Prints a subsection title in HTML format to std::cout.
@@ -110,7 +110,7 @@ private:
         // SEQAN_ASSERT_NOT_MSG(isDl && isP, "Current <dl> and <p> are mutually exclusive.");
         maybe_close_list();
         maybe_close_paragraph();
-        std::cout << "<h3>" << to_html(title) << "</h3>\n";
+        page << "<h3>" << to_html(title) << "</h3>\n";
     }
 
     /*!\brief Prints a text in HTML format to std::cout.
@@ -124,14 +124,14 @@ private:
         maybe_close_list();
         if (!is_p) // open parapgraph
         {
-            std::cout << "<p>\n";
+            page << "<p>\n";
             is_p = true;
         }
-        std::cout << to_html(text) << "\n";
+        page << to_html(text) << "\n";
         if (line_is_paragraph)
             maybe_close_paragraph();
         else
-            std::cout << "<br>\n";
+            page << "<br>\n";
     }
 
     /*!\brief Prints a help page list_item in HTML format to std::cout.
@@ -150,11 +150,11 @@ private:
 
         if (!is_dl)
         {
-            std::cout << "<dl>\n";
+            page << "<dl>\n";
             is_dl = true;
         }
-        std::cout << "<dt>" << to_html(term) << "</dt>\n"
-                  << "<dd>" << to_html(desc) << "</dd>\n";
+        page << "<dt>" << to_html(term) << "</dt>\n"
+             << "<dd>" << to_html(desc) << "</dd>\n";
     }
 
     //!\brief Prints a help page footer in HTML format to std::cout.
@@ -163,7 +163,7 @@ private:
         maybe_close_paragraph();
 
         // Print HTML boilerplate footer.
-        std::cout << "</body></html>";
+        page << "</body></html>";
     }
 
     /*!\brief Converts console output formatting to the HTML equivalent.
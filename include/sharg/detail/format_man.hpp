@@ -57,29 +57,17 @@ private:
     //!\brief Prints a help page header in man page format to std::cout.
     void print_header()
     {
-        std::ostream_iterator<char> out(std::cout);
-
         // Print .TH line.
-        std::cout << ".TH ";
-        std::transform(meta.app_name.begin(),
-                       meta.app_name.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << " " << std::to_string(meta.man_page_section) << " \"" << meta.date << "\" \"";
-        std::transform(meta.app_name.begin(),
-                       meta.app_name.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::tolower(c);
-                       });
-        std::cout << " " << meta.version << "\" \"" << meta.man_page_title << "\"\n";
+        page << ".TH ";
+        for (unsigned char const c : meta.app_name)
+            page << static_cast<char>(std::toupper(c));
+        page << " " << meta.man_page_section << " \"" << meta.date << "\" \"";
+        for (unsigned char const c : meta.app_name)
+            page << static_cast<char>(std::tolower(c));
+        page << " " << meta.version << "\" \"" << meta.man_page_title << "\"\n";
 
         // Print NAME section.
-        std::cout << ".SH NAME\n" << meta.app_name << " \\- " << meta.short_description << std::endl;
+        page << ".SH NAME\n" << meta.app_name << " \\- " << meta.short_description << '\n';
     }
 
     /*!\brief Prints a section title in man page format to std::cout.
@@ -87,16 +75,10 @@ private:
      */
     void print_section(std::string const & title)
     {
-        std::ostream_iterator<char> out(std::cout);
-        std::cout << ".SH ";
-        std::transform(title.begin(),
-                       title.end(),
-                       out,
-                       [](unsigned char c)
-                       {
-                           return std::toupper(c);
-                       });
-        std::cout << "\n";
+        page << ".SH ";
+        for (unsigned char const c : title)
+            page << static_cast<char>(std::toupper(c));
+        page << "\n";
         is_first_in_section = true;
     }
 
@@ -105,7 +87,7 @@ private:
      */
     void print_subsection(std::string const & title)
     {
-        std::cout << ".SS " << title << "\n";
+        page << ".SS " << title << "\n";
         is_first_in_section = true;
     }
 
@@ -118,11 +100,11 @@ private:
     void print_line(std::string const & text, bool const line_is_paragraph)
     {
         if (!is_first_in_section && line_is_paragraph)
-            std::cout << ".sp\n";
+            page << ".sp\n";
         else if (!is_first_in_section && !line_is_paragraph)
-            std::cout << ".br\n";
+            page << ".br\n";
 
-        std::cout << text << "\n";
+        page << text << "\n";
         is_first_in_section = false;
     }
 
@@ -137,7 +119,7 @@ private:
      */
     void print_list_item(std::string const & term, std::string const & desc)
     {
-        std::cout << ".TP\n" << term << "\n" << desc << "\n";
+        page << ".TP\n" << term << "\n" << desc << "\n";
         is_first_in_section = false;
     }
 
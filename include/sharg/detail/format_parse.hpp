@@ -9,10 +9,18 @@
 
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+
 #include <sharg/std/charconv>
 
 #include <sharg/concept.hpp>
 #include <sharg/detail/format_base.hpp>
+#include <sharg/detail/validation_executor.hpp>
 
 namespace sharg::detail
 {
@@ -37,8 +45,17 @@ namespace sharg::detail
  * -#. Flags              (order within as specified by the developer)
  * -#. Positional Options (order within as specified by the developer)
  *
- * When parsing flags and options, the identifiers (and values) are removed from
- * the vector format_parse::arguments. That way, options that are specified multiple times,
+ * Each value is validated right after it was parsed, unless validation is asynchronous (see
+ * format_parse::enable_async_validation). Then, the validations are collected in parsing order and run on
+ * background threads by a sharg::detail::validation_executor after parse() returned.
+ *
+ * Before any call is executed, format_parse::arguments is tokenized once: every argument is classified
+ * (see format_parse::token_kind) and the positions of all short and long identifiers are stored in a hash index
+ * (format_parse::id_positions). Looking up an identifier therefore does not require a scan over all arguments.
+ *
+ * The arguments are views into the original command line (`argv`) and are never copied or modified.
+ * When parsing flags and options, the identifiers (and values) are marked as consumed in
+ * format_parse::consumed. That way, options that are specified multiple times,
  * but are no container type, can be identified and an error is reported.
  *
  * \remark For a complete overview, take a look at \ref parser
@@ -59,7 +76,7 @@ public:
     /*!\brief The constructor of the parse format.
      * \param[in] cmd_arguments The command line arguments to parse.
      */
-    format_parse(std::vector<std::string> cmd_arguments) : arguments{std::move(cmd_arguments)}
+    format_parse(std::vector<std::string_view> cmd_arguments) : arguments{std::move(cmd_arguments)}
     {}
     //!\}
 
@@ -105,7 +122,7 @@ public:
     //!\brief Initiates the actual command line parsing.
     void parse(parser_meta_data const & /*meta*/)
     {
-        end_of_options_it = std::find(arguments.begin(), arguments.end(), "--");
+        tokenize_arguments();
 
         // parse options first, because we need to rule out -keyValue pairs
         // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
@@ -117,13 +134,43 @@ public:
 
         check_for_unknown_ids();
 
-        if (end_of_options_it != arguments.end())
-            *end_of_options_it = ""; // remove -- before parsing positional arguments
+        if (end_of_options_pos != arguments.size())
+            consumed[end_of_options_pos] = true; // remove -- before parsing positional arguments
 
         for (auto && f : positional_option_calls)
             f();
 
         check_for_left_over_args();
+
+        if (executor != nullptr)
+            executor->start();
+    }
+
+    /*!\brief Defers validating the values until parse() returned, see sharg::parser::enable_async_validation.
+     * \details
+     * The validations are run on background threads. wait_validated() waits for them.
+     */
+    void enable_async_validation()
+    {
+        executor = std::make_shared<validation_executor>();
+    }
+
+    /*!\brief Waits until the deferred validations finished.
+     * \throws sharg::validation_error of the first value that is not valid in parsing order.
+     */
+    void wait_validated() const
+    {
+        if (executor != nullptr)
+            executor->wait();
+    }
+
+    /*!\brief Waits until the deferred validations finished and returns the error that wait_validated() did not throw.
+     * \returns The exception of the first value that is not valid, or `nullptr`; see
+     *          sharg::detail::validation_executor::unobserved_error.
+     */
+    std::exception_ptr unobserved_validation_error() const
+    {
+        return executor != nullptr ? executor->unobserved_error() : nullptr;
     }
 
     // functions are not needed for command line parsing but are part of the format help interface.
@@ -177,7 +224,7 @@ public:
 
         return (std::find_if(begin_it,
                              end_it,
-                             [&](std::string const & current_arg)
+                             [&](std::string_view const current_arg)
                              {
                                  std::string full_id = prepend_dash(id);
 
@@ -198,6 +245,159 @@ public:
     }
 
 private:
+    //!\brief The classification of a single command line argument.
+    enum class token_kind : uint8_t
+    {
+        value,         //!< A bare value, e.g. `foo`, `-` or any argument after `--`.
+        short_id,      //!< A short identifier or a cluster of short flags, e.g. `-i`, `-iValue` or `-rGv`.
+        long_id,       //!< A long identifier with or without a value, e.g. `--id` or `--id=value`.
+        end_of_options //!< The first `--`.
+    };
+
+    /*!\brief Classifies every argument and builds the identifier index.
+     * \details
+     *
+     * Each argument before the first `--` is classified as sharg::detail::format_parse::token_kind.
+     * For short identifiers, the key `-c` (the first two characters) is indexed, for long identifiers the key `--id`
+     * (everything before the first `=`). Arguments after `--` are always values and are not indexed.
+     * Empty arguments are marked as consumed right away, because they can never be assigned to an option.
+     */
+    void tokenize_arguments()
+    {
+        token_kinds.assign(arguments.size(), token_kind::value);
+        consumed.assign(arguments.size(), false);
+        flag_clusters.clear();
+        for (std::vector<size_t> & clusters : clusters_with_flag)
+            clusters.clear();
+        id_positions.clear();
+
+        for (size_t i = 0; i < arguments.size(); ++i)
+            consumed[i] = arguments[i].empty();
+
+        size_t pos{};
+        for (; pos < arguments.size(); ++pos)
+        {
+            std::string_view const arg{arguments[pos]};
+
+            if (arg.size() < 2 || arg[0] != '-')
+                continue; // value
+
+            if (arg[1] != '-')
+            {
+                token_kinds[pos] = token_kind::short_id;
+                id_positions[arg.substr(0, 2)].push_back(pos);
+                decode_flag_cluster(pos);
+            }
+            else if (arg.size() == 2)
+            {
+                token_kinds[pos] = token_kind::end_of_options;
+                break;
+            }
+            else
+            {
+                token_kinds[pos] = token_kind::long_id;
+                id_positions[arg.substr(0, arg.find('='))].push_back(pos);
+            }
+        }
+
+        end_of_options_pos = pos;
+    }
+
+    /*!\brief Returns the positions of all arguments that start with the given identifier.
+     * \param[in] id The short or long identifier (without dashes).
+     * \returns The ascending positions in format_parse::arguments; may contain already consumed arguments.
+     */
+    template <typename id_type>
+    std::vector<size_t> const & positions_of(id_type const & id) const
+    {
+        static std::vector<size_t> const no_positions{};
+
+        if (is_empty_id(id))
+            return no_positions;
+
+        auto it = id_positions.find(prepend_dash(id));
+        return it == id_positions.end() ? no_positions : it->second;
+    }
+
+    /*!\brief Returns the first position in [`first`, `last`) whose argument has not been consumed yet.
+     * \param[in] first The iterator to the first position to check.
+     * \param[in] last The iterator one past the last position to check.
+     * \returns An iterator to the found position or `last`.
+     */
+    std::vector<size_t>::const_iterator next_unconsumed(std::vector<size_t>::const_iterator first,
+                                                        std::vector<size_t>::const_iterator last) const
+    {
+        return std::find_if(first,
+                            last,
+                            [this](size_t const pos)
+                            {
+                                return !consumed[pos];
+                            });
+    }
+
+    //!\brief A short identifier argument, e.g. `-rGv`, decoded into the set of characters it contains.
+    struct flag_cluster
+    {
+        //!\brief The position of the cluster in format_parse::arguments.
+        size_t position{};
+        //!\brief The characters (excluding the leading dash) that have not been consumed by a flag yet.
+        std::bitset<256> remaining{};
+        //!\brief Whether a character occurs more than once in the cluster.
+        bool has_duplicates{false};
+    };
+
+    /*!\brief Decodes the short identifier argument at `pos` into a format_parse::flag_cluster.
+     * \param[in] pos The position of a format_parse::token_kind::short_id argument.
+     */
+    void decode_flag_cluster(size_t const pos)
+    {
+        flag_cluster cluster{.position = pos};
+
+        for (char const c : arguments[pos].substr(1))
+        {
+            unsigned char const flag = static_cast<unsigned char>(c);
+
+            if (cluster.remaining[flag])
+            {
+                cluster.has_duplicates = true;
+            }
+            else
+            {
+                cluster.remaining.set(flag);
+                clusters_with_flag[flag].push_back(flag_clusters.size());
+            }
+        }
+
+        flag_clusters.push_back(cluster);
+    }
+
+    /*!\brief Returns the not yet consumed flags of a short identifier cluster.
+     * \param[in] cluster The decoded cluster.
+     * \returns The cluster including the leading dash, without all flags that have already been consumed.
+     *
+     * \details
+     *
+     * A consumed flag only removes its first occurrence in the cluster, e.g. `-vv` becomes `-v` if the flag `v` was
+     * consumed.
+     */
+    std::string remaining_flags(flag_cluster const & cluster) const
+    {
+        std::string result{'-'};
+        std::bitset<256> seen{};
+
+        for (char const c : arguments[cluster.position].substr(1))
+        {
+            unsigned char const flag = static_cast<unsigned char>(c);
+
+            if (cluster.remaining[flag] || seen[flag])
+                result.push_back(c);
+
+            seen.set(flag);
+        }
+
+        return result;
+    }
+
     //!\brief Describes the result of parsing the user input string given the respective option value type.
     enum class option_parse_result
     {
@@ -244,12 +444,18 @@ private:
      */
     bool flag_is_set(std::string const & long_id)
     {
-        auto it = std::find(arguments.begin(), end_of_options_it, prepend_dash(long_id));
+        std::string const full_id = prepend_dash(long_id);
 
-        if (it != end_of_options_it)
-            *it = ""; // remove seen flag
+        for (size_t const pos : positions_of(long_id))
+        {
+            if (!consumed[pos] && arguments[pos] == full_id) // `--id=value` is indexed under the same key but is no flag
+            {
+                consumed[pos] = true; // remove seen flag
+                return true;
+            }
+        }
 
-        return (it != end_of_options_it);
+        return false;
     }
 
     /*!\brief Returns true and removes the short identifier if it is in format_parse::arguments.
@@ -258,42 +464,80 @@ private:
     bool flag_is_set(char const short_id)
     {
         // short flags need special attention, since they could be grouped (-rGv <=> -r -G -v)
-        for (std::string & arg : arguments)
+        unsigned char const flag = static_cast<unsigned char>(short_id);
+
+        for (size_t const index : clusters_with_flag[flag])
         {
-            if (arg[0] == '-' && arg.size() > 1 && arg[1] != '-') // is option && not dash && no long option
-            {
-                auto pos = arg.find(short_id);
+            flag_cluster & cluster = flag_clusters[index];
 
-                if (pos != std::string::npos)
-                {
-                    arg.erase(pos, 1); // remove seen bool
+            if (consumed[cluster.position] || !cluster.remaining[flag])
+                continue;
 
-                    if (arg == "-") // if flag is empty now
-                        arg = "";
+            cluster.remaining.reset(flag); // remove seen bool
 
-                    return true;
-                }
-            }
+            // if flag is empty now; repeated characters always leave a remainder
+            if (cluster.remaining.none() && !cluster.has_duplicates)
+                consumed[cluster.position] = true;
+
+            return true;
         }
+
         return false;
     }
 
-    /*!\brief Tries to parse an input string into a value using the stream `operator>>`.
-     * \tparam option_t Must model sharg::istreamable.
+    /*!\brief Tries to parse an input string into a value using sharg::from_string or the stream `operator>>`.
+     * \tparam option_t Must model sharg::istreamable or sharg::from_string_parsable.
      * \param[out] value Stores the parsed value.
      * \param[in] in The input argument to be parsed.
-     * \returns sharg::option_parse_result::error if `in` could not be parsed via the stream
-     *          operator and otherwise sharg::option_parse_result::success.
+     * \returns sharg::option_parse_result::error if `in` could not be parsed and otherwise
+     *          sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * The value is parsed by the first applicable of:
+     * -# the customisation point sharg::from_string,
+     * -# constructing a std::filesystem::path from the std::string_view, which would otherwise be read with
+     *    std::quoted semantics and stop at the first whitespace,
+     * -# the stream operator (`operator>>`).
+     *
+     * Other types that are constructible from a std::string_view are read via their stream operator; they may
+     * customise sharg::from_string instead.
      */
     template <typename option_t>
-        requires istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+        requires istreamable<option_t> || from_string_parsable<option_t>
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        std::istringstream stream{in};
-        stream >> value;
+        if constexpr (from_string_parsable<option_t>)
+        {
+            try
+            {
+                value = sharg::from_string<option_t>(in);
+            }
+            catch (parser_error const &)
+            {
+                throw;
+            }
+            catch (std::exception const &)
+            {
+                return option_parse_result::error;
+            }
 
-        if (stream.fail() || !stream.eof())
-            return option_parse_result::error;
+            return option_parse_result::success;
+        }
+        else if constexpr (std::same_as<option_t, std::filesystem::path>)
+        {
+            value = in;
+            return option_parse_result::success;
+        }
+
+        if constexpr (istreamable<option_t>)
+        {
+            std::istringstream stream{std::string{in}};
+            stream >> value;
+
+            if (stream.fail() || !stream.eof())
+                return option_parse_result::error;
+        }
 
         return option_parse_result::success;
     }
@@ -306,9 +550,9 @@ private:
      * \returns sharg::option_parse_result::success.
      */
     template <named_enumeration option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto map = sharg::enumeration_names<option_t>;
+        auto const & map = sharg::enumeration_names<option_t>;
 
         if (auto it = map.find(in); it == map.end())
         {
@@ -336,7 +580,8 @@ private:
                 return result;
             }();
 
-            throw user_input_error{"You have chosen an invalid input value: " + in + ". Please use one of: " + keys};
+            throw user_input_error{"You have chosen an invalid input value: " + std::string{in}
+                                   + ". Please use one of: " + keys};
         }
         else
         {
@@ -347,7 +592,7 @@ private:
     }
 
     //!\cond
-    option_parse_result parse_option_value(std::string & value, std::string const & in)
+    option_parse_result parse_option_value(std::string & value, std::string_view const in)
     {
         value = in;
         return option_parse_result::success;
@@ -364,26 +609,61 @@ private:
      * \param[out] value The container that stores the parsed value.
      * \param[in] in The input argument to be parsed.
      * \returns A sharg::option_parse_result whether parsing was successful or not.
+     *
+     * \details
+     *
+     * If the container provides `emplace_back` and `back` returns a reference to the value type, the value is parsed
+     * directly into a new element at the end of the container, which is removed again if parsing fails or throws.
+     * Otherwise, the value is parsed into a temporary which is moved into the container.
      */
     // clang-format off
     template <detail::is_container_option container_option_t, typename format_parse_t = format_parse>
         requires requires (format_parse_t fp,
                            typename container_option_t::value_type & container_value,
-                           std::string const & in)
+                           std::string_view const in)
         {
             {fp.parse_option_value(container_value, in)} -> std::same_as<option_parse_result>;
         }
     // clang-format on
-    option_parse_result parse_option_value(container_option_t & value, std::string const & in)
+    option_parse_result parse_option_value(container_option_t & value, std::string_view const in)
     {
-        typename container_option_t::value_type tmp{};
+        using value_t = typename container_option_t::value_type;
+
+        if constexpr (requires {
+                          value.emplace_back();
+                          { value.back() } -> std::same_as<value_t &>;
+                          value.pop_back();
+                      })
+        {
+            value.emplace_back();
+            option_parse_result res{};
+
+            try
+            {
+                res = parse_option_value(value.back(), in);
+            }
+            catch (...) // e.g. sharg::user_input_error for an invalid enumeration value
+            {
+                value.pop_back();
+                throw;
+            }
+
+            if (res != option_parse_result::success)
+                value.pop_back();
+
+            return res;
+        }
+        else // e.g. std::vector<bool>
+        {
+            value_t tmp{};
 
-        auto res = parse_option_value(tmp, in);
+            auto res = parse_option_value(tmp, in);
 
-        if (res == option_parse_result::success)
-            value.push_back(tmp);
+            if (res == option_parse_result::success)
+                value.push_back(std::move(tmp));
 
-        return res;
+            return res;
+        }
     }
 
     /*!\brief Tries to parse an input string into an arithmetic value.
@@ -396,17 +676,25 @@ private:
      *
      * \details
      *
-     * This function delegates to std::from_chars.
+     * This function delegates to std::from_chars. If `SHARG_FAST_FROM_CHARS` is defined to `1`, `float` and `double`
+     * are parsed by sharg::contrib::charconv_float::from_chars_fast instead.
      */
     template <typename option_t>
         requires std::is_arithmetic_v<option_t> && istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    option_parse_result parse_option_value(option_t & value, std::string_view const in)
     {
-        auto res = std::from_chars(&in[0], &in[in.size()], value);
+        char const * const end = in.data() + in.size();
+        auto res = [&]()
+        {
+            if constexpr (SHARG_FAST_FROM_CHARS && (std::same_as<option_t, float> || std::same_as<option_t, double>))
+                return sharg::contrib::charconv_float::from_chars_fast(in.data(), end, value);
+            else
+                return std::from_chars(in.data(), end, value);
+        }();
 
         if (res.ec == std::errc::result_out_of_range)
             return option_parse_result::overflow_error;
-        else if (res.ec == std::errc::invalid_argument || res.ptr != &in[in.size()])
+        else if (res.ec == std::errc::invalid_argument || res.ptr != end)
             return option_parse_result::error;
 
         return option_parse_result::success;
@@ -422,7 +710,7 @@ private:
      * This function accepts the strings "0" or "false" which sets sets `value` to `false` or "1" or "true" which
      * sets `value` to `true`.
      */
-    option_parse_result parse_option_value(bool & value, std::string const & in)
+    option_parse_result parse_option_value(bool & value, std::string_view const in)
     {
         if (in == "0")
             value = false;
@@ -448,13 +736,13 @@ private:
     template <typename option_type>
     void throw_on_input_error(option_parse_result const res,
                               std::string const & option_name,
-                              std::string const & input_value)
+                              std::string_view const input_value)
     {
         std::string msg{"Value parse failed for " + option_name + ": "};
 
         if (res == option_parse_result::error)
         {
-            throw user_input_error{msg + "Argument " + input_value + " could not be parsed as type "
+            throw user_input_error{msg + "Argument " + std::string{input_value} + " could not be parsed as type "
                                    + get_type_name_as_string(option_type{}) + "."};
         }
 
@@ -462,7 +750,8 @@ private:
         {
             if (res == option_parse_result::overflow_error)
             {
-                throw user_input_error{msg + "Numeric argument " + input_value + " is not in the valid range ["
+                throw user_input_error{msg + "Numeric argument " + std::string{input_value}
+                                       + " is not in the valid range ["
                                        + std::to_string(std::numeric_limits<option_type>::min()) + ","
                                        + std::to_string(std::numeric_limits<option_type>::max()) + "]."};
             }
@@ -471,70 +760,115 @@ private:
         assert(res == option_parse_result::success); // if nothing was thrown, the result must have been a success
     }
 
+    /*!\brief Splits `in` at `list_separator` and appends each element to the container `value`.
+     *
+     * \param[out] value          The container that stores the parsed values.
+     * \param[in]  in             The input argument to be split and parsed.
+     * \param[in]  list_separator The character that separates the elements.
+     * \param[in]  option_name    The option identifier supplied on the command line, used in error messages.
+     *
+     * \throws sharg::user_input_error if an element could not be parsed.
+     *
+     * \details
+     *
+     * The separators are found with `std::memchr`, which standard libraries implement with vector instructions.
+     * For the first occurrence of the option, the container reserves space for all elements at once.
+     */
+    template <detail::is_container_option option_type>
+    void parse_separated_option_values(option_type & value,
+                                       std::string_view in,
+                                       char const list_separator,
+                                       std::string const & option_name)
+    {
+        if constexpr (requires { value.reserve(size_t{}); })
+        {
+            // Later occurrences rely on the geometric growth of the container.
+            if (value.empty())
+                value.reserve(std::ranges::count(in, list_separator) + 1u);
+        }
+
+        while (true)
+        {
+            void const * const separator = std::memchr(in.data(), list_separator, in.size());
+            size_t const length = separator ? static_cast<char const *>(separator) - in.data() : in.size();
+            std::string_view const element = in.substr(0, length);
+
+            auto res = parse_option_value(value, element);
+            throw_on_input_error<std::ranges::range_value_t<option_type>>(res, option_name, element);
+
+            if (separator == nullptr)
+                break;
+
+            in.remove_prefix(length + 1u);
+        }
+    }
+
     /*!\brief Handles value retrieval for options based on different key-value pairs.
      *
-     * \param[out] value     Stores the value found in arguments, parsed by parse_option_value.
-     * \param[in]  option_it The iterator where the option identifier was found.
-     * \param[in]  id        The option identifier supplied on the command line.
+     * \param[out] value          The variable that stores the value found in arguments, parsed by parse_option_value.
+     * \param[in]  pos            The position in format_parse::arguments where the option identifier was found.
+     * \param[in]  id             The option identifier supplied on the command line.
+     * \param[in]  list_separator If not `'\0'`, the value of a container option is split at this character.
      *
      * \throws sharg::too_few_arguments if the option was not followed by a value.
      * \throws sharg::user_input_error if the given option value was invalid.
      *
      * \details
      *
-     * The value at option_it is inspected whether it is an '-key value', '-key=value'
+     * The value at `pos` is inspected whether it is an '-key value', '-key=value'
      * or '-keyValue' pair and the input is extracted accordingly. The input
      * will then be tried to be parsed into the `value` parameter.
-     *
-     * Returns true on success and false otherwise.
      */
     template <typename option_type, typename id_type>
-    bool identify_and_retrieve_option_value(option_type & value,
-                                            std::vector<std::string>::iterator & option_it,
-                                            id_type const & id)
+    void identify_and_retrieve_option_value(option_type & value,
+                                            size_t const pos,
+                                            id_type const & id,
+                                            char const list_separator = '\0')
     {
-        if (option_it != end_of_options_it)
-        {
-            std::string input_value;
-            size_t id_size = (prepend_dash(id)).size();
+        std::string_view const option_arg{arguments[pos]};
+        std::string_view input_value;
+        size_t id_size = (prepend_dash(id)).size();
+
+        consumed[pos] = true; // remove used identifier (and the value if it is part of the identifier)
 
-            if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
+        if (option_arg.size() > id_size) // identifier includes value (-keyValue or -key=value)
+        {
+            if (option_arg[id_size] == '=') // -key=value
             {
-                if ((*option_it)[id_size] == '=') // -key=value
-                {
-                    if ((*option_it).size() == id_size + 1) // malformed because no value follows '-i='
-                        throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                    input_value = (*option_it).substr(id_size + 1);
-                }
-                else // -kevValue
-                {
-                    input_value = (*option_it).substr(id_size);
-                }
-
-                *option_it = ""; // remove used identifier-value pair
+                if (option_arg.size() == id_size + 1) // malformed because no value follows '-i='
+                    throw too_few_arguments("Missing value for option " + prepend_dash(id));
+                input_value = option_arg.substr(id_size + 1);
             }
-            else // -key value
+            else // -kevValue
             {
-                *option_it = ""; // remove used identifier
-                ++option_it;
-                if (option_it == end_of_options_it) // should not happen
-                    throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                input_value = *option_it;
-                *option_it = ""; // remove value
+                input_value = option_arg.substr(id_size);
             }
+        }
+        else // -key value
+        {
+            size_t const value_pos = pos + 1;
+            if (value_pos >= end_of_options_pos) // should not happen
+                throw too_few_arguments("Missing value for option " + prepend_dash(id));
+            if (!consumed[value_pos]) // a value that was already consumed is read as empty string
+                input_value = arguments[value_pos];
+            consumed[value_pos] = true; // remove value
+        }
 
-            auto res = parse_option_value(value, input_value);
-            throw_on_input_error<option_type>(res, prepend_dash(id), input_value);
-
-            return true;
+        if constexpr (detail::is_container_option<option_type>)
+        {
+            if (list_separator != '\0')
+                return parse_separated_option_values(value, input_value, list_separator, prepend_dash(id));
         }
-        return false;
+
+        auto res = parse_option_value(value, input_value);
+        throw_on_input_error<option_type>(res, prepend_dash(id), input_value);
     }
 
     /*!\brief Handles value retrieval (non container type) options.
      *
      * \param[out] value Stores the value found in arguments, parsed by parse_option_value.
      * \param[in] id The option identifier supplied on the command line.
+     * \param[in] list_separator Unused; only container options can have a list separator.
      *
      * \throws sharg::option_declared_multiple_times
      *
@@ -549,24 +883,28 @@ private:
      * (non container!) option by specifying the short AND long identifier.
      */
     template <typename option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    bool get_option_by_id(option_type & value, id_type const & id, char const /*list_separator*/)
     {
-        auto it = find_option_id(arguments.begin(), end_of_options_it, id);
+        std::vector<size_t> const & positions = positions_of(id);
+        auto pos_it = next_unconsumed(positions.begin(), positions.end());
+
+        if (pos_it == positions.end())
+            return false;
 
-        if (it != end_of_options_it)
-            identify_and_retrieve_option_value(value, it, id);
+        identify_and_retrieve_option_value(value, *pos_it, id);
 
-        if (find_option_id(it, end_of_options_it, id) != end_of_options_it) // should not be found again
+        if (next_unconsumed(pos_it, positions.end()) != positions.end()) // should not be found again
             throw option_declared_multiple_times("Option " + prepend_dash(id)
                                                  + " is no list/container but declared multiple times.");
 
-        return (it != end_of_options_it); // first search was successful or not
+        return true;
     }
 
     /*!\brief Handles value retrieval (container type) options.
      *
-     * \param[out] value Stores all values found in arguments, parsed by parse_option_value.
-     * \param[in]  id    The option identifier supplied on the command line.
+     * \param[out] value          Stores all values found in arguments, parsed by parse_option_value.
+     * \param[in]  id             The option identifier supplied on the command line.
+     * \param[in]  list_separator If not `'\0'`, each value is split at this character (see sharg::config).
      *
      * \details
      *
@@ -575,18 +913,19 @@ private:
      *
      */
     template <detail::is_container_option option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    bool get_option_by_id(option_type & value, id_type const & id, char const list_separator)
     {
-        auto it = find_option_id(arguments.begin(), end_of_options_it, id);
-        bool seen_at_least_once{it != end_of_options_it};
+        std::vector<size_t> const & positions = positions_of(id);
+        auto pos_it = next_unconsumed(positions.begin(), positions.end());
+        bool seen_at_least_once{pos_it != positions.end()};
 
         if (seen_at_least_once)
             value.clear();
 
-        while (it != end_of_options_it)
+        while (pos_it != positions.end())
         {
-            identify_and_retrieve_option_value(value, it, id);
-            it = find_option_id(it, end_of_options_it, id);
+            identify_and_retrieve_option_value(value, *pos_it, id, list_separator);
+            pos_it = next_unconsumed(pos_it, positions.end());
         }
 
         return seen_at_least_once;
@@ -607,29 +946,36 @@ private:
      */
     void check_for_unknown_ids()
     {
-        for (auto it = arguments.begin(); it != end_of_options_it; ++it)
+        auto cluster_it = flag_clusters.begin(); // clusters are stored in the order of their positions
+
+        for (size_t pos = 0; pos < end_of_options_pos; ++pos)
         {
-            std::string arg{*it};
-            if (!arg.empty() && arg[0] == '-') // may be an identifier
+            if (token_kinds[pos] == token_kind::value)
+                continue;
+
+            bool const is_cluster = token_kinds[pos] == token_kind::short_id;
+
+            if (is_cluster)
+                ++cluster_it;
+
+            if (consumed[pos]) // known option or flag
+                continue;
+
+            std::string arg = is_cluster ? remaining_flags(*std::prev(cluster_it)) : std::string{arguments[pos]};
+
+            if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
+            {
+                throw unknown_option("Unknown flags " + expand_multiple_flags(arg)
+                                     + ". In case this is meant to be a non-option/argument/parameter, "
+                                     + "please specify the start of arguments with '--'. "
+                                     + "See -h/--help for program information.");
+            }
+            else // unknown short or long option
             {
-                if (arg == "-")
-                {
-                    continue; // positional option
-                }
-                else if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
-                {
-                    throw unknown_option("Unknown flags " + expand_multiple_flags(arg)
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of arguments with '--'. "
-                                         + "See -h/--help for program information.");
-                }
-                else // unknown short or long option
-                {
-                    throw unknown_option("Unknown option " + arg
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of non-options with '--'. "
-                                         + "See -h/--help for program information.");
-                }
+                throw unknown_option("Unknown option " + arg
+                                     + ". In case this is meant to be a non-option/argument/parameter, "
+                                     + "please specify the start of non-options with '--'. "
+                                     + "See -h/--help for program information.");
             }
         }
     }
@@ -647,13 +993,7 @@ private:
      */
     void check_for_left_over_args()
     {
-        if (std::find_if(arguments.begin(),
-                         arguments.end(),
-                         [](std::string const & s)
-                         {
-                             return (s != "");
-                         })
-            != arguments.end())
+        if (std::ranges::find(consumed, false) != consumed.end())
             throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
     }
 
@@ -677,8 +1017,8 @@ private:
     template <typename option_type, typename validator_t>
     void get_option(option_type & value, config<validator_t> const & config)
     {
-        bool short_id_is_set{get_option_by_id(value, config.short_id)};
-        bool long_id_is_set{get_option_by_id(value, config.long_id)};
+        bool short_id_is_set{get_option_by_id(value, config.short_id, config.list_separator)};
+        bool long_id_is_set{get_option_by_id(value, config.long_id, config.list_separator)};
 
         // if value is no container we need to check for multiple declarations
         if (short_id_is_set && long_id_is_set && !detail::is_container_option<option_type>)
@@ -687,15 +1027,12 @@ private:
 
         if (short_id_is_set || long_id_is_set)
         {
-            try
-            {
-                config.validator(value);
-            }
-            catch (std::exception & ex)
-            {
-                throw validation_error(std::string("Validation failed for option ")
-                                       + combine_option_names(config.short_id, config.long_id) + ": " + ex.what());
-            }
+            validate(value,
+                     config.validator,
+                     [this, &config]()
+                     {
+                         return "option " + combine_option_names(config.short_id, config.long_id);
+                     });
         }
         else // option is not set
         {
@@ -733,31 +1070,41 @@ private:
      * \details
      *
      * This function assumes that
-     * -#) arguments has been stripped from all known options and flags
+     * -#) all known options and flags in arguments have been consumed
      * -#) arguments has been checked for unknown options
-     * -#) arguments does not contain "--" anymore
-     *  Thus we can simply iterate over non empty entries of arguments.
+     * -#) "--" has been consumed
+     *  Thus we can simply iterate over the not consumed entries of arguments.
      *
      * This function
      * - checks if the user did not provide enough arguments,
-     * - retrieves the next (no container type) or all (container type) remaining non empty value/s in arguments
+     * - retrieves the next (no container type) or all (container type) remaining not consumed value/s in arguments
      */
     template <typename option_type, typename validator_type>
     void get_positional_option(option_type & value, validator_type && validator)
     {
         ++positional_option_count;
-        auto it = std::find_if(arguments.begin(),
-                               arguments.end(),
-                               [](std::string const & s)
-                               {
-                                   return (s != "");
-                               });
-
-        if (it == arguments.end())
+        // Positional options are parsed in order, so there is no need to search before the last consumed position.
+        auto it = std::find(consumed.begin() + next_positional_pos, consumed.end(), false);
+
+        if (it == consumed.end())
             throw too_few_arguments("Not enough positional arguments provided (Need at least "
                                     + std::to_string(positional_option_calls.size())
                                     + "). See -h/--help for more information.");
 
+        auto parse_positional_value = [&](auto & target)
+        {
+            std::string_view const arg{arguments[it - consumed.begin()]};
+            auto res = parse_option_value(target, arg);
+
+            if (res != option_parse_result::success)
+            {
+                std::string id = "positional option" + std::to_string(positional_option_count);
+                throw_on_input_error<option_type>(res, id, arg);
+            }
+
+            *it = true; // remove arg from arguments
+        };
+
         if constexpr (detail::is_container_option<
                           option_type>) // vector/list will be filled with all remaining arguments
         {
@@ -765,39 +1112,83 @@ private:
 
             value.clear();
 
-            while (it != arguments.end())
+            if constexpr (requires { value.reserve(size_t{}); })
+                value.reserve(std::count(it, consumed.end(), false));
+
+            while (it != consumed.end())
             {
-                auto res = parse_option_value(value, *it);
-                std::string id = "positional option" + std::to_string(positional_option_count);
-                throw_on_input_error<option_type>(res, id, *it);
-
-                *it = ""; // remove arg from arguments
-                it = std::find_if(it,
-                                  arguments.end(),
-                                  [](std::string const & s)
-                                  {
-                                      return (s != "");
-                                  });
+                parse_positional_value(value);
+                it = std::find(it, consumed.end(), false);
                 ++positional_option_count;
             }
         }
         else
         {
-            auto res = parse_option_value(value, *it);
-            std::string id = "positional option" + std::to_string(positional_option_count);
-            throw_on_input_error<option_type>(res, id, *it);
+            parse_positional_value(value);
+        }
+
+        next_positional_pos = it - consumed.begin();
 
-            *it = ""; // remove arg from arguments
+        validate(value,
+                 validator,
+                 [this]()
+                 {
+                     return "positional option " + std::to_string(positional_option_count);
+                 });
+    }
+
+    /*!\brief Applies `validator` to `value`, or adds the validation to format_parse::executor if there is one.
+     * \param[in] value The parsed value; copied if the validation is deferred.
+     * \param[in] validator The validator; copied if the validation is deferred.
+     * \param[in] name Returns the name of the option in the error message, e.g. `option -i`.
+     *
+     * \details
+     * The deferred validation owns copies, such that the application may modify or destroy the value, e.g. when an
+     * exception is thrown before sharg::parser::wait_validated is called. Values that cannot be copied are validated
+     * immediately.
+     */
+    template <typename option_type, typename validator_type, typename name_t>
+    void validate(option_type const & value, validator_type const & validator, name_t const & name)
+    {
+        if constexpr (std::copy_constructible<option_type>)
+        {
+            if (executor != nullptr)
+            {
+                executor->add(
+                    [value, validator, name = name()]()
+                    {
+                        apply_validator(value,
+                                        validator,
+                                        [&name]()
+                                        {
+                                            return name;
+                                        });
+                    });
+                return;
+            }
         }
 
+        apply_validator(value, validator, name);
+    }
+
+    /*!\brief Applies `validator` to `value`.
+     * \throws sharg::validation_error, or sharg::validation_timeout if the validator timed out, with the message of
+     *         the validator prefixed by the name of the option.
+     */
+    template <typename option_type, typename validator_type, typename name_t>
+    static void apply_validator(option_type const & value, validator_type const & validator, name_t const & name)
+    {
         try
         {
             validator(value);
         }
+        catch (validation_timeout & ex)
+        {
+            throw validation_timeout("Validation failed for " + name() + ": " + ex.what());
+        }
         catch (std::exception & ex)
         {
-            throw validation_error("Validation failed for positional option " + std::to_string(positional_option_count)
-                                   + ": " + ex.what());
+            throw validation_error("Validation failed for " + name() + ": " + ex.what());
         }
     }
 
@@ -807,12 +1198,26 @@ private:
     std::vector<std::function<void()>> flag_calls;
     //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
     std::vector<std::function<void()>> positional_option_calls;
+    //!\brief Runs the validations after parsing if validation is asynchronous; `nullptr` otherwise.
+    std::shared_ptr<validation_executor> executor{};
     //!\brief Keeps track of the number of specified positional options.
     unsigned positional_option_count{0};
-    //!\brief Vector of command line arguments.
-    std::vector<std::string> arguments;
-    //!\brief Artificial end of arguments if \-- was seen.
-    std::vector<std::string>::iterator end_of_options_it;
+    //!\brief The position in format_parse::arguments from which on the next positional option is searched.
+    size_t next_positional_pos{0};
+    //!\brief Vector of command line arguments (views into the original command line).
+    std::vector<std::string_view> arguments;
+    //!\brief Marks which arguments have already been consumed by an option, flag or positional option.
+    std::vector<bool> consumed;
+    //!\brief Artificial end of arguments (position of the first \--, or `arguments.size()`).
+    size_t end_of_options_pos{};
+    //!\brief The classification of each argument in format_parse::arguments.
+    std::vector<token_kind> token_kinds;
+    //!\brief Maps a dashed identifier (`-c` or `--id`) to the ascending positions of its occurrences in arguments.
+    std::unordered_map<std::string_view, std::vector<size_t>> id_positions;
+    //!\brief All short identifier arguments before \-- decoded as flag clusters, in the order of their positions.
+    std::vector<flag_cluster> flag_clusters;
+    //!\brief For each character, the ascending indices of all format_parse::flag_clusters that contain it.
+    std::array<std::vector<size_t>, 256> clusters_with_flag;
 };
 
 } // namespace sharg::detail
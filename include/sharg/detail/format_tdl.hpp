@@ -144,6 +144,9 @@ public:
      */
     parser_meta_data meta;
 
+    //!\brief The stream that the description is printed to. Set by the sharg::parser before calling parse().
+    std::ostream * stream{&std::cout};
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -314,7 +317,7 @@ public:
             });
     }
 
-    /*!\brief Initiates the printing of the help page to std::cout.
+    /*!\brief Initiates the printing of the help page to sharg::detail::format_tdl::stream.
      * \param[in] parser_meta The meta information that are needed for a detailed help page.
      * \param[in] executable_name A list of arguments that form together the call to the executable.
      *                            For example: [raptor, build]
@@ -361,17 +364,16 @@ public:
 
         if (fileFormat == FileFormat::CTD)
         {
-            std::cout << tdl::convertToCTD(info);
+            *stream << tdl::convertToCTD(info);
         }
         else if (fileFormat == FileFormat::CWL)
         {
-            std::cout << tdl::convertToCWL(info) << "\n";
+            *stream << tdl::convertToCWL(info) << "\n";
         }
         else
         {
             throw std::runtime_error("unsupported file format (this is a bug)");
         }
-        std::exit(EXIT_SUCCESS); // program should not continue from here
     }
 
     /*!\brief Adds a print_section call to parser_set_up_calls.
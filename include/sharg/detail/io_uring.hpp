@@ -0,0 +1,299 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::io_uring_queue.
+ */
+
+#pragma once
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+/*!\brief Whether sharg::detail::io_uring_queue is available.
+ * \ingroup misc
+ * \details
+ *
+ * Defaults to `1` on Linux if the kernel headers provide `IORING_OP_STATX` (Linux 5.6), and to `0` otherwise.
+ * Define to `0` to never use io_uring. Even if defined to `1`, io_uring may still be unavailable at runtime, e.g.
+ * if it is disabled by a seccomp filter or the `kernel.io_uring_disabled` sysctl.
+ */
+#ifndef SHARG_HAS_IO_URING
+#    if defined(__linux__) && defined(IORING_FEAT_CUR_PERSONALITY) && defined(__NR_io_uring_setup)
+#        define SHARG_HAS_IO_URING 1
+#    else
+#        define SHARG_HAS_IO_URING 0
+#    endif
+#endif
+
+namespace sharg::detail
+{
+
+#if SHARG_HAS_IO_URING
+/*!\brief A minimal io_uring submission and completion queue.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * The queue uses the raw system calls, i.e. it does not depend on liburing. Requests are prepared via next_sqe()
+ * and submit_and_wait() submits them and waits until all of them completed. Then, for_each_completion() visits
+ * the completions.
+ *
+ * If io_uring is not available, is_open() returns `false` and the queue must not be used.
+ */
+class io_uring_queue
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    io_uring_queue(io_uring_queue const &) = delete;             //!< Deleted.
+    io_uring_queue & operator=(io_uring_queue const &) = delete; //!< Deleted.
+
+    /*!\brief Sets up a queue with `entries` submission queue entries.
+     * \param[in] entries The size of the submission queue; rounded up to a power of two by the kernel.
+     * \param[in,out] syscall_counter Incremented for every system call issued by the queue, including the
+     *                                system calls of the destructor.
+     */
+    io_uring_queue(unsigned const entries, size_t & syscall_counter) noexcept : system_calls{syscall_counter}
+    {
+        io_uring_params parameters{};
+        ++system_calls;
+        ring_fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &parameters));
+
+        if (ring_fd < 0)
+            return;
+
+        sq_ring_size = parameters.sq_off.array + parameters.sq_entries * sizeof(uint32_t);
+        cq_ring_size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        sqes_size = parameters.sq_entries * sizeof(io_uring_sqe);
+        bool const single_mmap = parameters.features & IORING_FEAT_SINGLE_MMAP;
+
+        if (single_mmap)
+            sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+
+        sq_ring = map(sq_ring_size, IORING_OFF_SQ_RING);
+        cq_ring = single_mmap ? sq_ring : map(cq_ring_size, IORING_OFF_CQ_RING);
+        sqes = static_cast<io_uring_sqe *>(map(sqes_size, IORING_OFF_SQES));
+
+        if (sq_ring == nullptr || cq_ring == nullptr || sqes == nullptr)
+            return;
+
+        std::byte * const sq = static_cast<std::byte *>(sq_ring);
+        sq_tail = reinterpret_cast<uint32_t *>(sq + parameters.sq_off.tail);
+        sq_mask = *reinterpret_cast<uint32_t *>(sq + parameters.sq_off.ring_mask);
+        sq_array = reinterpret_cast<uint32_t *>(sq + parameters.sq_off.array);
+        sq_entries = parameters.sq_entries;
+
+        std::byte * const cq = static_cast<std::byte *>(cq_ring);
+        cq_head = reinterpret_cast<uint32_t *>(cq + parameters.cq_off.head);
+        cq_tail = reinterpret_cast<uint32_t *>(cq + parameters.cq_off.tail);
+        cq_mask = *reinterpret_cast<uint32_t *>(cq + parameters.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe *>(cq + parameters.cq_off.cqes);
+
+        local_sq_tail = *sq_tail;
+        is_mapped = true;
+    }
+
+    //!\brief Unmaps the rings and closes the queue.
+    ~io_uring_queue()
+    {
+        unmap(sqes, sqes_size);
+
+        if (cq_ring != sq_ring)
+            unmap(cq_ring, cq_ring_size);
+
+        unmap(sq_ring, sq_ring_size);
+
+        if (ring_fd >= 0)
+        {
+            ++system_calls;
+            ::close(ring_fd);
+        }
+    }
+    //!\}
+
+    //!\brief Whether the queue was set up successfully.
+    bool is_open() const noexcept
+    {
+        return is_mapped;
+    }
+
+    //!\brief Whether the kernel supports all `opcodes`.
+    bool supports(std::initializer_list<uint8_t> const opcodes) noexcept
+    {
+        // struct io_uring_probe is followed by a flexible array of struct io_uring_probe_op.
+        constexpr size_t max_ops{256u};
+        std::vector<uint64_t> buffer((sizeof(io_uring_probe) + max_ops * sizeof(io_uring_probe_op)) / sizeof(uint64_t));
+        io_uring_probe * const probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+
+        ++system_calls;
+        if (::syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, max_ops) < 0)
+            return false;
+
+        return std::ranges::all_of(opcodes,
+                                   [&](uint8_t const opcode)
+                                   {
+                                       return opcode <= probe->last_op
+                                           && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+                                   });
+    }
+
+    //!\brief The number of requests that can be prepared before calling submit_and_wait().
+    unsigned capacity() const noexcept
+    {
+        return sq_entries;
+    }
+
+    /*!\brief Returns a zeroed submission queue entry to prepare a request, or `nullptr` if the queue is full.
+     * \details
+     * The `user_data` of the entry is passed to the callback of for_each_completion().
+     */
+    io_uring_sqe * next_sqe() noexcept
+    {
+        if (prepared == sq_entries)
+            return nullptr;
+
+        uint32_t const index = local_sq_tail & sq_mask;
+        io_uring_sqe * const sqe = sqes + index;
+        *sqe = io_uring_sqe{};
+        sq_array[index] = index;
+        ++local_sq_tail;
+        ++prepared;
+        return sqe;
+    }
+
+    /*!\brief Submits all prepared requests and waits until all of them completed.
+     * \returns `0` on success or the `errno` of the failing `io_uring_enter` call.
+     */
+    int submit_and_wait() noexcept
+    {
+        std::atomic_ref<uint32_t>{*sq_tail}.store(local_sq_tail, std::memory_order_release);
+        unsigned unsubmitted = prepared;
+
+        while (unsubmitted > 0u || completions() < prepared)
+        {
+            ++system_calls;
+            long const submitted = ::syscall(__NR_io_uring_enter,
+                                             ring_fd,
+                                             unsubmitted,
+                                             prepared - completions(),
+                                             IORING_ENTER_GETEVENTS,
+                                             nullptr,
+                                             0);
+
+            if (submitted < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return errno;
+            }
+
+            unsubmitted -= static_cast<unsigned>(submitted);
+        }
+
+        return 0;
+    }
+
+    /*!\brief Calls `callback(user_data, result)` for every completed request and removes the completions.
+     * \details
+     * The result is the return value of the corresponding system call or `-errno`.
+     */
+    template <typename callback_t>
+    void for_each_completion(callback_t && callback)
+    {
+        uint32_t head = *cq_head;
+        uint32_t const tail = std::atomic_ref<uint32_t>{*cq_tail}.load(std::memory_order_acquire);
+
+        for (; head != tail; ++head)
+            callback(cqes[head & cq_mask].user_data, cqes[head & cq_mask].res);
+
+        std::atomic_ref<uint32_t>{*cq_head}.store(head, std::memory_order_release);
+        prepared = 0u;
+    }
+
+private:
+    //!\brief The file descriptor of the queue.
+    int ring_fd{-1};
+    //!\brief Whether the rings are mapped.
+    bool is_mapped{false};
+    //!\brief The number of system calls.
+    size_t & system_calls;
+
+    //!\brief The mapped submission queue ring.
+    void * sq_ring{nullptr};
+    //!\brief The mapped completion queue ring; equal to sq_ring if both are mapped at once.
+    void * cq_ring{nullptr};
+    //!\brief The mapped submission queue entries.
+    io_uring_sqe * sqes{nullptr};
+    //!\brief The size of the submission queue ring.
+    size_t sq_ring_size{};
+    //!\brief The size of the completion queue ring.
+    size_t cq_ring_size{};
+    //!\brief The size of the submission queue entries.
+    size_t sqes_size{};
+
+    //!\brief The tail of the submission queue as seen by the kernel.
+    uint32_t * sq_tail{nullptr};
+    //!\brief Maps submission queue ring indices to entry indices.
+    uint32_t * sq_array{nullptr};
+    //!\brief The mask of the submission queue ring indices.
+    uint32_t sq_mask{};
+    //!\brief The number of submission queue entries.
+    uint32_t sq_entries{};
+    //!\brief The tail of the submission queue including the prepared requests.
+    uint32_t local_sq_tail{};
+    //!\brief The number of prepared requests whose completions were not visited yet.
+    uint32_t prepared{};
+
+    //!\brief The head of the completion queue.
+    uint32_t * cq_head{nullptr};
+    //!\brief The tail of the completion queue.
+    uint32_t * cq_tail{nullptr};
+    //!\brief The mask of the completion queue ring indices.
+    uint32_t cq_mask{};
+    //!\brief The completion queue entries.
+    io_uring_cqe * cqes{nullptr};
+
+    //!\brief Returns the number of completions that were not visited yet.
+    uint32_t completions() const noexcept
+    {
+        return std::atomic_ref<uint32_t>{*cq_tail}.load(std::memory_order_acquire) - *cq_head;
+    }
+
+    //!\brief Maps `size` bytes of the queue at `offset`; returns `nullptr` on failure.
+    void * map(size_t const size, off_t const offset) noexcept
+    {
+        ++system_calls;
+        void * const address =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+        return address == MAP_FAILED ? nullptr : address;
+    }
+
+    //!\brief Unmaps `size` bytes at `address` if it is mapped.
+    void unmap(void * const address, size_t const size) noexcept
+    {
+        if (address == nullptr)
+            return;
+
+        ++system_calls;
+        ::munmap(address, size);
+    }
+};
+#endif
+
+} // namespace sharg::detail
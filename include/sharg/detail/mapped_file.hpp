@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::mapped_file.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#else
+#    include <fstream>
+#endif
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A writable, private copy of a file's content.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * On POSIX systems, the file is mapped with `MAP_PRIVATE`: pages are read lazily and only copied if they are
+ * written to. On Windows, the file is read into a buffer.
+ *
+ * The content does not move when a mapped_file is moved, i.e. views into the content stay valid.
+ */
+class mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_file() = default;                                //!< Defaulted.
+    mapped_file(mapped_file const &) = delete;              //!< Deleted.
+    mapped_file & operator=(mapped_file const &) = delete;  //!< Deleted.
+
+    //!\brief Takes over the content of `other`.
+    mapped_file(mapped_file && other) noexcept :
+        content{std::exchange(other.content, nullptr)},
+        content_size{std::exchange(other.content_size, 0u)}
+    {}
+
+    //!\brief Takes over the content of `other`.
+    mapped_file & operator=(mapped_file && other) noexcept
+    {
+        std::swap(content, other.content);
+        std::swap(content_size, other.content_size);
+        return *this;
+    }
+
+    //!\brief Unmaps the file.
+    ~mapped_file()
+    {
+        if (content == nullptr)
+            return;
+
+#ifndef _WIN32
+        munmap(content, content_size);
+#else
+        delete[] content;
+#endif
+    }
+
+    /*!\brief Maps the file at `path`.
+     * \param[in] path The path of the file.
+     * \param[in] description What the file is used for, e.g. "response file"; used in the error message.
+     * \throws sharg::user_input_error if the file cannot be read.
+     */
+    explicit mapped_file(std::filesystem::path const & path, std::string_view const description = "file")
+    {
+#ifndef _WIN32
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat status
+        {};
+
+        if (fd == -1 || ::fstat(fd, &status) == -1)
+        {
+            if (fd != -1)
+                ::close(fd);
+            throw_read_error(path, description);
+        }
+
+        content_size = static_cast<size_t>(status.st_size);
+
+        if (content_size > 0u)
+        {
+            void * const address = ::mmap(nullptr, content_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            if (address == MAP_FAILED)
+            {
+                ::close(fd);
+                throw_read_error(path, description);
+            }
+
+            content = static_cast<char *>(address);
+            ::madvise(address, content_size, MADV_SEQUENTIAL);
+        }
+
+        ::close(fd); // The mapping stays valid.
+#else
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+
+        if (!file)
+            throw_read_error(path, description);
+
+        content_size = static_cast<size_t>(file.tellg());
+        content = new char[content_size];
+        file.seekg(0);
+
+        if (!file.read(content, content_size))
+            throw_read_error(path, description);
+#endif
+    }
+    //!\}
+
+    //!\brief Returns a pointer to the first character.
+    char * begin() noexcept
+    {
+        return content;
+    }
+
+    //!\brief Returns a pointer behind the last character.
+    char * end() noexcept
+    {
+        return content + content_size;
+    }
+
+private:
+    //!\brief The content of the file.
+    char * content{nullptr};
+    //!\brief The size of the file in bytes.
+    size_t content_size{};
+
+    //!\brief Throws a sharg::user_input_error for `path`.
+    [[noreturn]] static void throw_read_error(std::filesystem::path const & path, std::string_view const description)
+    {
+        throw user_input_error{"The " + std::string{description} + " " + path.string() + " could not be read."};
+    }
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::output_buffer.
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if !defined(_WIN32)
+#    include <unistd.h>
+#endif
+
+#include <sharg/detail/to_string.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Collects the output of the help formats, which is written at once.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The help formats (help, man, html, version, ...) render the complete page into the buffer and call write_to()
+ * once. If the stream is std::cout and std::cout was not redirected, the page is passed to a single `write(2)` call
+ * instead of going through the stream.
+ */
+class output_buffer
+{
+public:
+    //!\brief Appends a string.
+    output_buffer & operator<<(std::string_view const text)
+    {
+        content.append(text);
+        return *this;
+    }
+
+    //!\brief Appends a character.
+    output_buffer & operator<<(char const character)
+    {
+        content.push_back(character);
+        return *this;
+    }
+
+    //!\brief Appends a number via std::to_chars.
+    template <chars_formattable number_t>
+    output_buffer & operator<<(number_t const number)
+    {
+        append_number(content, number);
+        return *this;
+    }
+
+    //!\brief Appends `count` copies of `character`, e.g. the padding of a column.
+    void append(size_t const count, char const character)
+    {
+        content.append(count, character);
+    }
+
+    //!\brief Returns the buffered output.
+    std::string_view view() const noexcept
+    {
+        return content;
+    }
+
+    //!\brief Writes the buffered output to `stream` and clears the buffer.
+    void write_to(std::ostream & stream)
+    {
+#if !defined(_WIN32)
+        if (&stream == &std::cout && std::cout.rdbuf() == standard_output_buffer)
+        {
+            // Output that is still buffered by std::cout or stdio precedes the page.
+            std::cout.flush();
+            std::fflush(stdout);
+
+            if (!write_to_standard_output())
+                std::cout.setstate(std::ios_base::badbit);
+
+            content.clear();
+            return;
+        }
+#endif
+        stream.write(content.data(), content.size());
+        stream.flush();
+        content.clear();
+    }
+
+private:
+    //!\brief The output.
+    std::string content{};
+
+#if !defined(_WIN32)
+    //!\brief The stream buffer of std::cout at start-up. If std::cout uses another buffer, it was redirected.
+    static inline std::streambuf * const standard_output_buffer = []()
+    {
+        std::ios_base::Init const init{}; // Ensures that std::cout is constructed.
+        return std::cout.rdbuf();
+    }();
+
+    //!\brief Writes the content to the standard output file descriptor; repeats on partial writes.
+    bool write_to_standard_output() const
+    {
+        for (size_t written = 0; written < content.size();)
+        {
+            ssize_t const result = ::write(STDOUT_FILENO, content.data() + written, content.size() - written);
+
+            if (result == -1 && errno == EINTR)
+                continue;
+
+            if (result <= 0)
+                return false;
+
+            written += result;
+        }
+
+        return true;
+    }
+#endif
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,1188 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::regex_compiler and sharg::detail::static_regex.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace sharg::detail
+{
+
+/*!\brief A minimal resizable array that can be used in constant expressions.
+ * \ingroup misc
+ * \tparam value_t The type of the elements; must be default constructible.
+ *
+ * \details
+ *
+ * `std::vector` cannot be used in constant expressions with GCC 11.
+ */
+template <typename value_t>
+class regex_buffer
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr regex_buffer() = default; //!< Defaulted.
+
+    //!\brief Constructs a buffer with `count` copies of `value`.
+    constexpr regex_buffer(size_t const count, value_t const value = value_t{})
+    {
+        reserve(count);
+        std::fill_n(elements, count, value);
+        element_count = count;
+    }
+
+    //!\brief Copies the elements of `other`.
+    constexpr regex_buffer(regex_buffer const & other)
+    {
+        reserve(other.element_count);
+        std::copy_n(other.elements, other.element_count, elements);
+        element_count = other.element_count;
+    }
+
+    //!\brief Takes over the elements of `other`.
+    constexpr regex_buffer(regex_buffer && other) noexcept :
+        elements{std::exchange(other.elements, nullptr)},
+        element_count{std::exchange(other.element_count, 0u)},
+        element_capacity{std::exchange(other.element_capacity, 0u)}
+    {}
+
+    //!\brief Copies the elements of `other`.
+    constexpr regex_buffer & operator=(regex_buffer const & other)
+    {
+        if (this != &other)
+        {
+            regex_buffer copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    //!\brief Takes over the elements of `other`.
+    constexpr regex_buffer & operator=(regex_buffer && other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    //!\brief Frees the elements.
+    constexpr ~regex_buffer()
+    {
+        delete[] elements;
+    }
+    //!\}
+
+    //!\brief Appends `value`.
+    constexpr void push_back(value_t const value)
+    {
+        if (element_count == element_capacity)
+            reserve(std::max<size_t>(2u * element_capacity, 8u));
+
+        elements[element_count++] = value;
+    }
+
+    //!\brief Appends `count` copies of `value`.
+    constexpr void append(size_t const count, value_t const value)
+    {
+        if (element_count + count > element_capacity)
+            reserve(std::max(2u * element_capacity, element_count + count));
+
+        std::fill_n(elements + element_count, count, value);
+        element_count += count;
+    }
+
+    //!\brief Removes all but the first `count` elements.
+    constexpr void truncate(size_t const count) noexcept
+    {
+        element_count = std::min(element_count, count);
+    }
+
+    //!\brief Returns the number of elements.
+    constexpr size_t size() const noexcept
+    {
+        return element_count;
+    }
+
+    //!\brief Returns a pointer to the first element.
+    constexpr value_t * data() noexcept
+    {
+        return elements;
+    }
+
+    //!\copydoc data
+    constexpr value_t const * data() const noexcept
+    {
+        return elements;
+    }
+
+    //!\brief Returns the element at position `index`.
+    constexpr value_t & operator[](size_t const index) noexcept
+    {
+        return elements[index];
+    }
+
+    //!\copydoc operator[]
+    constexpr value_t const & operator[](size_t const index) const noexcept
+    {
+        return elements[index];
+    }
+
+private:
+    //!\brief The elements.
+    value_t * elements{nullptr};
+    //!\brief The number of elements.
+    size_t element_count{};
+    //!\brief The number of elements that fit into the allocated memory.
+    size_t element_capacity{};
+
+    //!\brief Grows the allocated memory to `capacity` elements.
+    constexpr void reserve(size_t const capacity)
+    {
+        if (capacity <= element_capacity)
+            return;
+
+        value_t * new_elements = new value_t[capacity]{};
+        std::copy_n(elements, element_count, new_elements);
+        delete[] elements;
+        elements = new_elements;
+        element_capacity = capacity;
+    }
+
+    //!\brief Swaps the content with `other`.
+    constexpr void swap(regex_buffer & other) noexcept
+    {
+        std::swap(elements, other.elements);
+        std::swap(element_count, other.element_count);
+        std::swap(element_capacity, other.element_capacity);
+    }
+};
+
+//!\brief A set of bytes (a character class).
+//!\ingroup misc
+struct regex_byte_set
+{
+    //!\brief One bit per byte value.
+    std::array<uint64_t, 4> words{};
+
+    //!\brief Adds the byte `chr`.
+    constexpr void insert(unsigned char const chr) noexcept
+    {
+        words[chr / 64u] |= uint64_t{1u} << (chr % 64u);
+    }
+
+    //!\brief Adds all bytes in the range [first, last].
+    constexpr void insert(unsigned char const first, unsigned char const last) noexcept
+    {
+        for (unsigned chr = first; chr <= last; ++chr)
+            insert(static_cast<unsigned char>(chr));
+    }
+
+    //!\brief Adds all bytes of `other`.
+    constexpr void insert(regex_byte_set const & other) noexcept
+    {
+        for (size_t i = 0; i < words.size(); ++i)
+            words[i] |= other.words[i];
+    }
+
+    //!\brief Whether the byte `chr` is contained.
+    constexpr bool contains(unsigned char const chr) const noexcept
+    {
+        return (words[chr / 64u] >> (chr % 64u)) & 1u;
+    }
+
+    //!\brief Returns the complement.
+    constexpr regex_byte_set complement() const noexcept
+    {
+        regex_byte_set result{};
+        for (size_t i = 0; i < words.size(); ++i)
+            result.words[i] = ~words[i];
+        return result;
+    }
+};
+
+//!\brief The result of compiling a regular expression with sharg::detail::regex_compiler.
+//!\ingroup misc
+enum class regex_status : uint8_t
+{
+    ok,          //!< The pattern was compiled.
+    invalid,     //!< The pattern is not a valid ECMAScript regular expression.
+    unsupported, //!< The pattern uses a feature that is not supported, e.g. back-references.
+    too_complex  //!< The automaton of the pattern exceeds the size limits.
+};
+
+/*!\brief Walks a deterministic finite automaton over `str` and returns the length of the longest accepted prefix.
+ * \ingroup misc
+ * \param[in] str The string.
+ * \param[in] byte_class Maps each byte to its byte class.
+ * \param[in] class_count The number of byte classes.
+ * \param[in] transitions The transition table (state * class_count + class).
+ * \param[in] accepting Whether a state is accepting.
+ * \param[in] whole Whether only the complete string is of interest.
+ * \returns The length of the longest accepted prefix or std::string_view::npos. If `whole` is set, either the size
+ *          of `str` or std::string_view::npos.
+ *
+ * \details
+ *
+ * State 0 is the dead state and state 1 is the start state.
+ */
+template <typename transitions_t, typename accepting_t>
+constexpr size_t regex_walk(std::string_view const str,
+                            std::array<uint8_t, 256> const & byte_class,
+                            size_t const class_count,
+                            transitions_t const & transitions,
+                            accepting_t const & accepting,
+                            bool const whole) noexcept
+{
+    size_t state{1u};
+    size_t result = accepting[state] ? 0u : std::string_view::npos;
+
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        state = transitions[state * class_count + byte_class[static_cast<unsigned char>(str[i])]];
+
+        if (state == 0u)
+            return whole ? std::string_view::npos : result;
+
+        if (!whole && accepting[state])
+            result = i + 1u;
+    }
+
+    if (whole)
+        return accepting[state] ? str.size() : std::string_view::npos;
+
+    return result;
+}
+
+/*!\brief A deterministic finite automaton that matches a regular expression.
+ * \ingroup misc
+ * \details
+ * Created by sharg::detail::regex_compiler.
+ */
+struct regex_dfa
+{
+    //!\brief The maximal number of states.
+    static constexpr size_t max_states{4096u};
+
+    //!\brief Whether the pattern was compiled; all other members are only valid if it is sharg::regex_status::ok.
+    regex_status status{regex_status::ok};
+    //!\brief Maps each byte to its byte class. Bytes of the same class are interchangeable in the pattern.
+    std::array<uint8_t, 256> byte_class{};
+    //!\brief The number of byte classes.
+    size_t class_count{};
+    //!\brief The number of states, including the dead state 0 and the start state 1.
+    size_t state_count{};
+    //!\brief The transition table (state * class_count + class).
+    regex_buffer<uint32_t> transitions{};
+    //!\brief Whether a state is accepting.
+    regex_buffer<bool> accepting{};
+
+    //!\brief Whether the complete string `str` matches the pattern.
+    constexpr bool match(std::string_view const str) const noexcept
+    {
+        return regex_walk(str, byte_class, class_count, transitions, accepting, true) != std::string_view::npos;
+    }
+
+    //!\brief Returns the length of the longest prefix of `str` that matches the pattern or std::string_view::npos.
+    constexpr size_t longest_prefix(std::string_view const str) const noexcept
+    {
+        return regex_walk(str, byte_class, class_count, transitions, accepting, false);
+    }
+};
+
+/*!\brief Compiles a regular expression into a sharg::detail::regex_dfa.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * The compiler accepts the subset of the ECMAScript grammar of `std::regex` that describes regular languages:
+ * literals, `.`, bracket expressions with ranges and negation, the escapes `\d`, `\D`, `\w`, `\W`, `\s`, `\S`, `\t`,
+ * `\n`, `\r`, `\f`, `\v` and `\xHH`, escaped punctuation, (non-capturing) groups, `|` and the (lazy) quantifiers `*`,
+ * `+`, `?`, `{n}`, `{n,}` and `{n,m}`. `^` and `$` may only appear at the beginning and end of a top-level alternative.
+ * Other features, e.g. back-references, assertions or POSIX character classes, result in
+ * sharg::detail::regex_status::unsupported.
+ *
+ * As for `std::regex_match`, the automaton only accepts strings that match the pattern completely. Since only the
+ * existence of a match is of interest, the automaton is built from the Glushkov automaton of the pattern, which has
+ * one state per character (class) in the pattern and no epsilon transitions, by the subset construction. Bytes that
+ * the pattern does not distinguish share a byte class, hence the transition table is small.
+ *
+ * All functions can be used in constant expressions, see sharg::detail::static_regex.
+ */
+class regex_compiler
+{
+public:
+    //!\brief Constructs the compiler for `pattern`.
+    constexpr explicit regex_compiler(std::string_view const pattern) noexcept : pattern{pattern}
+    {}
+
+    /*!\brief Compiles the pattern.
+     * \param[in] max_states The maximal number of states of the automaton.
+     * \returns The automaton; check regex_dfa::status.
+     */
+    constexpr regex_dfa compile(size_t const max_states = regex_dfa::max_states)
+    {
+        regex_dfa dfa{};
+        size_t const root = parse_alternation(true);
+
+        if (status == regex_status::ok && position != pattern.size()) // An unmatched ')'.
+            fail(regex_status::invalid);
+
+        if (status == regex_status::ok && count_positions(root) > max_positions)
+            fail(regex_status::too_complex);
+
+        if (status != regex_status::ok)
+        {
+            dfa.status = status;
+            return dfa;
+        }
+
+        build_glushkov(root);
+        build_dfa(dfa, max_states);
+        dfa.status = status;
+        return dfa;
+    }
+
+private:
+    //!\brief The maximal number of character (class) occurrences after expanding counted repetitions.
+    static constexpr size_t max_positions{4096u};
+    //!\brief The maximal number of repetitions of `{n,m}`.
+    static constexpr size_t max_repetitions{1000u};
+    //!\brief Marks an unbounded repetition.
+    static constexpr size_t unbounded{std::numeric_limits<size_t>::max()};
+
+    //!\brief A node of the syntax tree.
+    struct node
+    {
+        //!\brief The kind of the node.
+        enum class kind : uint8_t
+        {
+            empty,       //!< Matches the empty string.
+            bytes,       //!< Matches one byte of `bytes`.
+            concat,      //!< Matches `left` followed by `right`.
+            alternation, //!< Matches `left` or `right`.
+            repeat       //!< Matches `left` between `min` and `max` times.
+        };
+
+        kind type{kind::empty};  //!< The kind of the node.
+        regex_byte_set bytes{};  //!< The bytes of kind::bytes.
+        size_t left{};           //!< The first child.
+        size_t right{};          //!< The second child.
+        size_t min{};            //!< The minimal number of repetitions of kind::repeat.
+        size_t max{};            //!< The maximal number of repetitions of kind::repeat.
+    };
+
+    //!\brief The set of first and last positions of a sub-expression.
+    struct fragment
+    {
+        regex_buffer<uint64_t> first{}; //!< The positions that can match the first byte.
+        regex_buffer<uint64_t> last{};  //!< The positions that can match the last byte.
+        bool nullable{true};            //!< Whether the empty string matches.
+    };
+
+    //!\brief The pattern.
+    std::string_view pattern;
+    //!\brief The current position in the pattern.
+    size_t position{};
+    //!\brief The status of the compilation.
+    regex_status status{regex_status::ok};
+    //!\brief The nodes of the syntax tree.
+    regex_buffer<node> nodes{};
+
+    //!\brief The number of positions (occurrences of byte classes in the expanded pattern).
+    size_t position_count{};
+    //!\brief The number of 64 bit words of a set of positions, including the start position.
+    size_t words{};
+    //!\brief The bytes that each position matches.
+    regex_buffer<regex_byte_set> position_bytes{};
+    //!\brief The positions that may follow a position (`words` words per position, including the start position).
+    regex_buffer<uint64_t> follow{};
+    //!\brief The positions that may match the last byte; contains the start position if the pattern is nullable.
+    regex_buffer<uint64_t> final_positions{};
+
+    /*!\name Parsing
+     * \{
+     */
+    //!\brief Stops parsing and records `error`, unless an error was recorded before.
+    constexpr size_t fail(regex_status const error) noexcept
+    {
+        if (status == regex_status::ok)
+            status = error;
+
+        position = pattern.size();
+        return 0u;
+    }
+
+    //!\brief Whether the pattern continues with `chr`.
+    constexpr bool next_is(char const chr) const noexcept
+    {
+        return position < pattern.size() && pattern[position] == chr;
+    }
+
+    //!\brief Adds a node and returns its index.
+    constexpr size_t add_node(node const & new_node)
+    {
+        nodes.push_back(new_node);
+        return nodes.size() - 1u;
+    }
+
+    //!\brief Adds a node of kind::bytes.
+    constexpr size_t add_bytes(regex_byte_set const & bytes)
+    {
+        return add_node(node{.type = node::kind::bytes, .bytes = bytes});
+    }
+
+    //!\brief Adds a node that concatenates `left` and `right`.
+    constexpr size_t add_concat(size_t const left, size_t const right)
+    {
+        if (nodes[left].type == node::kind::empty)
+            return right;
+
+        return add_node(node{.type = node::kind::concat, .left = left, .right = right});
+    }
+
+    //!\brief `alternation := concatenation ('|' concatenation)*`
+    constexpr size_t parse_alternation(bool const top_level)
+    {
+        size_t result = parse_concatenation(top_level);
+
+        while (status == regex_status::ok && next_is('|'))
+        {
+            ++position;
+            size_t const right = parse_concatenation(top_level);
+            result = add_node(node{.type = node::kind::alternation, .left = result, .right = right});
+        }
+
+        return result;
+    }
+
+    //!\brief `concatenation := '^'? (atom quantifier?)* '$'?`; anchors are only allowed on the top level.
+    constexpr size_t parse_concatenation(bool const top_level)
+    {
+        size_t result = add_node(node{});
+
+        if (top_level && next_is('^'))
+            ++position;
+
+        while (status == regex_status::ok && position < pattern.size() && !next_is('|') && !next_is(')'))
+        {
+            if (top_level && next_is('$'))
+            {
+                ++position;
+
+                if (position < pattern.size() && !next_is('|'))
+                    return fail(regex_status::unsupported);
+
+                break;
+            }
+
+            size_t const atom = parse_atom();
+            result = add_concat(result, parse_quantifier(atom));
+        }
+
+        return result;
+    }
+
+    //!\brief Parses a single character, an escape, a bracket expression or a group.
+    constexpr size_t parse_atom()
+    {
+        char const chr = pattern[position++];
+
+        switch (chr)
+        {
+            case '(':
+            {
+                if (next_is('?'))
+                {
+                    if (position + 1u < pattern.size() && pattern[position + 1u] == ':')
+                        position += 2u;
+                    else
+                        return fail(regex_status::unsupported); // Assertions.
+                }
+
+                size_t const group = parse_alternation(false);
+
+                if (!next_is(')'))
+                    return fail(regex_status::invalid);
+
+                ++position;
+                return group;
+            }
+            case '[':
+                return parse_bracket();
+            case '.':
+            {
+                regex_byte_set bytes{};
+                bytes.insert('\n');
+                bytes.insert('\r');
+                return add_bytes(bytes.complement());
+            }
+            case '\\':
+            {
+                regex_byte_set bytes{};
+
+                if (!parse_escape(bytes))
+                    return 0u;
+
+                return add_bytes(bytes);
+            }
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+                return fail(regex_status::invalid); // Nothing to repeat.
+            case ')':
+                return fail(regex_status::invalid);
+            case ']':
+            case '}':
+            case '^':
+            case '$':
+                return fail(regex_status::unsupported);
+            default:
+            {
+                regex_byte_set bytes{};
+                bytes.insert(static_cast<unsigned char>(chr));
+                return add_bytes(bytes);
+            }
+        }
+    }
+
+    //!\brief Parses `*`, `+`, `?`, `{n}`, `{n,}` or `{n,m}`, each optionally followed by `?` (lazy).
+    constexpr size_t parse_quantifier(size_t const atom)
+    {
+        if (status != regex_status::ok || position == pattern.size())
+            return atom;
+
+        size_t min{};
+        size_t max{};
+
+        switch (pattern[position])
+        {
+            case '*':
+                max = unbounded;
+                break;
+            case '+':
+                min = 1u;
+                max = unbounded;
+                break;
+            case '?':
+                max = 1u;
+                break;
+            case '{':
+            {
+                ++position;
+                min = parse_number();
+                max = min;
+
+                if (next_is(','))
+                {
+                    ++position;
+                    max = next_is('}') ? unbounded : parse_number();
+                }
+
+                if (status != regex_status::ok || !next_is('}') || max < min)
+                    return fail(regex_status::invalid);
+
+                if (max != unbounded ? max > max_repetitions : min > max_repetitions)
+                    return fail(regex_status::too_complex);
+
+                break;
+            }
+            default:
+                return atom;
+        }
+
+        ++position;
+
+        if (next_is('?')) // Lazy quantifiers match the same strings.
+            ++position;
+
+        if (next_is('*') || next_is('+') || next_is('?') || next_is('{'))
+            return fail(regex_status::invalid);
+
+        return add_node(node{.type = node::kind::repeat, .left = atom, .min = min, .max = max});
+    }
+
+    //!\brief Parses a decimal number.
+    constexpr size_t parse_number()
+    {
+        if (position == pattern.size() || pattern[position] < '0' || pattern[position] > '9')
+            return fail(regex_status::invalid);
+
+        size_t number{};
+
+        for (; position < pattern.size() && pattern[position] >= '0' && pattern[position] <= '9'; ++position)
+            number = std::min<size_t>(number * 10u + static_cast<size_t>(pattern[position] - '0'), max_positions);
+
+        return number;
+    }
+
+    /*!\brief Parses the escape sequence after a `\`.
+     * \param[out] bytes The bytes the escape sequence matches are added to this set.
+     * \returns Whether the escape sequence is supported and valid.
+     */
+    constexpr bool parse_escape(regex_byte_set & bytes)
+    {
+        if (position == pattern.size())
+        {
+            fail(regex_status::invalid);
+            return false;
+        }
+
+        char const chr = pattern[position++];
+        regex_byte_set digits{};
+        digits.insert('0', '9');
+        regex_byte_set word = digits;
+        word.insert('a', 'z');
+        word.insert('A', 'Z');
+        word.insert('_');
+        regex_byte_set space{};
+        space.insert('\t', '\r'); // \t \n \v \f \r
+        space.insert(' ');
+
+        auto hex_value = [](char const hex) -> int
+        {
+            if (hex >= '0' && hex <= '9')
+                return hex - '0';
+            if (hex >= 'a' && hex <= 'f')
+                return hex - 'a' + 10;
+            if (hex >= 'A' && hex <= 'F')
+                return hex - 'A' + 10;
+            return -1;
+        };
+
+        switch (chr)
+        {
+            case 'd':
+                bytes.insert(digits);
+                break;
+            case 'D':
+                bytes.insert(digits.complement());
+                break;
+            case 'w':
+                bytes.insert(word);
+                break;
+            case 'W':
+                bytes.insert(word.complement());
+                break;
+            case 's':
+                bytes.insert(space);
+                break;
+            case 'S':
+                bytes.insert(space.complement());
+                break;
+            case 't':
+                bytes.insert('\t');
+                break;
+            case 'n':
+                bytes.insert('\n');
+                break;
+            case 'r':
+                bytes.insert('\r');
+                break;
+            case 'f':
+                bytes.insert('\f');
+                break;
+            case 'v':
+                bytes.insert('\v');
+                break;
+            case 'x':
+            {
+                if (position + 2u > pattern.size() || hex_value(pattern[position]) < 0
+                    || hex_value(pattern[position + 1u]) < 0)
+                {
+                    fail(regex_status::invalid);
+                    return false;
+                }
+
+                bytes.insert(static_cast<unsigned char>(hex_value(pattern[position]) * 16
+                                                        + hex_value(pattern[position + 1u])));
+                position += 2u;
+                break;
+            }
+            default:
+            {
+                bool const is_alnum = (chr >= '0' && chr <= '9') || (chr >= 'a' && chr <= 'z')
+                                   || (chr >= 'A' && chr <= 'Z');
+
+                // Back-references, \b, \B, \cX, \uXXXX, ...
+                if (is_alnum)
+                {
+                    fail(regex_status::unsupported);
+                    return false;
+                }
+
+                bytes.insert(static_cast<unsigned char>(chr));
+            }
+        }
+
+        return true;
+    }
+
+    //!\brief Parses a bracket expression after the `[`.
+    constexpr size_t parse_bracket()
+    {
+        regex_byte_set bytes{};
+        bool const negated = next_is('^');
+        position += negated;
+
+        if (next_is(']'))
+            return fail(regex_status::unsupported); // Empty classes differ between implementations.
+
+        // Parses a single character or an escape; returns -1 for character classes like \d.
+        auto parse_item = [this, &bytes]() -> int
+        {
+            char const chr = pattern[position++];
+
+            if (chr == '[' && (next_is(':') || next_is('.') || next_is('=')))
+            {
+                fail(regex_status::unsupported);
+                return -1;
+            }
+
+            if (chr != '\\')
+                return static_cast<unsigned char>(chr);
+
+            char const escape = position < pattern.size() ? pattern[position] : '\0';
+            regex_byte_set escaped{};
+
+            if (!parse_escape(escaped))
+                return -1;
+
+            bytes.insert(escaped);
+            bool const is_class = escape == 'd' || escape == 'D' || escape == 'w' || escape == 'W' || escape == 's'
+                               || escape == 'S';
+
+            if (is_class)
+                return -1;
+
+            for (unsigned chr_value = 0; chr_value < 256u; ++chr_value)
+                if (escaped.contains(static_cast<unsigned char>(chr_value)))
+                    return static_cast<int>(chr_value);
+
+            return -1; // LCOV_EXCL_LINE
+        };
+
+        while (status == regex_status::ok && position < pattern.size() && !next_is(']'))
+        {
+            int const first = parse_item();
+
+            if (status != regex_status::ok)
+                break;
+
+            bool const is_range = next_is('-') && position + 1u < pattern.size() && pattern[position + 1u] != ']';
+
+            if (!is_range)
+            {
+                if (first >= 0)
+                    bytes.insert(static_cast<unsigned char>(first));
+                continue;
+            }
+
+            ++position; // '-'
+            int const last = parse_item();
+
+            if (status != regex_status::ok)
+                break;
+
+            // Ranges of character classes are errors; ranges of non-ASCII bytes depend on the signedness of char.
+            if (first < 0 || last < 0 || first >= 128 || last >= 128)
+                return fail(regex_status::unsupported);
+
+            if (first > last)
+                return fail(regex_status::invalid);
+
+            bytes.insert(static_cast<unsigned char>(first), static_cast<unsigned char>(last));
+        }
+
+        if (status != regex_status::ok)
+            return 0u;
+
+        if (!next_is(']'))
+            return fail(regex_status::invalid);
+
+        ++position;
+        return add_bytes(negated ? bytes.complement() : bytes);
+    }
+    //!\}
+
+    /*!\name Construction of the automaton
+     * \{
+     */
+    //!\brief Returns the number of positions of the sub-expression `index`, saturated at max_positions + 1.
+    constexpr size_t count_positions(size_t const index) const
+    {
+        node const & current = nodes[index];
+        size_t count{};
+
+        switch (current.type)
+        {
+            case node::kind::empty:
+                break;
+            case node::kind::bytes:
+                count = 1u;
+                break;
+            case node::kind::concat:
+            case node::kind::alternation:
+                count = count_positions(current.left) + count_positions(current.right);
+                break;
+            case node::kind::repeat:
+                count = count_positions(current.left) * copies(current);
+                break;
+        }
+
+        return std::min(count, max_positions + 1u);
+    }
+
+    //!\brief The number of copies of the child of a kind::repeat node in the automaton.
+    static constexpr size_t copies(node const & repeat) noexcept
+    {
+        return repeat.max == unbounded ? std::max<size_t>(repeat.min, 1u) : repeat.max;
+    }
+
+    //!\brief Adds `from` to `to`.
+    constexpr void unite(uint64_t * const to, uint64_t const * const from) const noexcept
+    {
+        for (size_t i = 0; i < words; ++i)
+            to[i] |= from[i];
+    }
+
+    //!\brief Calls `callback` for each position in `set`.
+    template <typename callback_t>
+    constexpr void for_each_position(uint64_t const * const set, callback_t && callback) const
+    {
+        for (size_t i = 0; i < words; ++i)
+            for (uint64_t bits = set[i]; bits != 0u; bits &= bits - 1u)
+                callback(i * 64u + static_cast<size_t>(std::countr_zero(bits)));
+    }
+
+    //!\brief Returns the fragment of `left` followed by `right` and adds the follow positions.
+    constexpr fragment concatenate(fragment left, fragment const & right)
+    {
+        for_each_position(left.last.data(),
+                          [&](size_t const last)
+                          {
+                              unite(follow.data() + last * words, right.first.data());
+                          });
+
+        if (left.nullable)
+            unite(left.first.data(), right.first.data());
+
+        if (right.nullable)
+            unite(left.last.data(), right.last.data());
+        else
+            left.last = right.last;
+
+        left.nullable = left.nullable && right.nullable;
+        return left;
+    }
+
+    //!\brief Assigns positions to the sub-expression `index` and returns its fragment.
+    constexpr fragment emit(size_t const index)
+    {
+        node const current = nodes[index];
+        fragment result{regex_buffer<uint64_t>(words), regex_buffer<uint64_t>(words), true};
+
+        switch (current.type)
+        {
+            case node::kind::empty:
+                break;
+            case node::kind::bytes:
+            {
+                size_t const new_position = position_count++;
+                position_bytes.push_back(current.bytes);
+                result.first[new_position / 64u] |= uint64_t{1u} << (new_position % 64u);
+                result.last = result.first;
+                result.nullable = false;
+                break;
+            }
+            case node::kind::concat:
+            {
+                fragment left = emit(current.left);
+                result = concatenate(std::move(left), emit(current.right));
+                break;
+            }
+            case node::kind::alternation:
+            {
+                result = emit(current.left);
+                fragment const right = emit(current.right);
+                unite(result.first.data(), right.first.data());
+                unite(result.last.data(), right.last.data());
+                result.nullable = result.nullable || right.nullable;
+                break;
+            }
+            case node::kind::repeat:
+            {
+                size_t const copy_count = count_positions(current.left) == 0u ? 0u : copies(current);
+
+                for (size_t i = 0; i < copy_count; ++i)
+                {
+                    fragment copy = emit(current.left);
+
+                    if (current.max == unbounded && i + 1u == copy_count) // The last copy loops.
+                    {
+                        for_each_position(copy.last.data(),
+                                          [&](size_t const last)
+                                          {
+                                              unite(follow.data() + last * words, copy.first.data());
+                                          });
+                    }
+
+                    copy.nullable = copy.nullable || i >= current.min;
+                    result = concatenate(std::move(result), copy);
+                }
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    //!\brief Builds the Glushkov automaton of the expression `root`.
+    constexpr void build_glushkov(size_t const root)
+    {
+        size_t const total = count_positions(root);
+        words = (total + 1u + 63u) / 64u; // + 1 for the start position.
+        follow = regex_buffer<uint64_t>((total + 1u) * words);
+
+        fragment const result = emit(root);
+
+        // The start position is followed by the first positions.
+        unite(follow.data() + position_count * words, result.first.data());
+        final_positions = result.last;
+
+        if (result.nullable)
+            final_positions[position_count / 64u] |= uint64_t{1u} << (position_count % 64u);
+    }
+
+    //!\brief Builds the deterministic automaton by the subset construction.
+    constexpr void build_dfa(regex_dfa & dfa, size_t const max_states)
+    {
+        // Bytes that are matched by the same positions form a byte class.
+        regex_buffer<uint64_t> signatures(256u * words);
+        for (size_t pos = 0; pos < position_count; ++pos)
+            for (unsigned chr = 0; chr < 256u; ++chr)
+                if (position_bytes[pos].contains(static_cast<unsigned char>(chr)))
+                    signatures[chr * words + pos / 64u] |= uint64_t{1u} << (pos % 64u);
+
+        regex_buffer<uint32_t> class_representative{};
+        for (unsigned chr = 0; chr < 256u; ++chr)
+        {
+            uint64_t const * const signature = signatures.data() + chr * words;
+            size_t cls{};
+
+            while (cls < class_representative.size()
+                   && !std::equal(signature, signature + words, signatures.data() + class_representative[cls] * words))
+            {
+                ++cls;
+            }
+
+            if (cls == class_representative.size())
+                class_representative.push_back(chr);
+
+            dfa.byte_class[chr] = static_cast<uint8_t>(cls);
+        }
+
+        size_t const class_count = class_representative.size();
+        dfa.class_count = class_count;
+
+        // State 0 is the dead state (no positions), state 1 the start state (only the start position).
+        regex_buffer<uint64_t> sets(2u * words);
+        sets[words + position_count / 64u] |= uint64_t{1u} << (position_count % 64u);
+
+        size_t const table_size = std::bit_ceil(2u * max_states);
+        regex_buffer<uint32_t> table(table_size, std::numeric_limits<uint32_t>::max());
+        size_t state_count{};
+
+        auto hash = [this](uint64_t const * const set) -> size_t
+        {
+            uint64_t result{0xcbf29ce484222325ULL};
+            for (size_t i = 0; i < words; ++i)
+                result = (result ^ set[i]) * 0x9e3779b97f4a7c15ULL;
+            return static_cast<size_t>(result ^ (result >> 29));
+        };
+
+        // Returns the state of the set at the end of `sets`, adds the state if it is new.
+        auto find_or_add = [&]() -> size_t
+        {
+            uint64_t const * const set = sets.data() + state_count * words;
+
+            for (size_t slot = hash(set) & (table_size - 1u);; slot = (slot + 1u) & (table_size - 1u))
+            {
+                if (table[slot] == std::numeric_limits<uint32_t>::max())
+                {
+                    table[slot] = static_cast<uint32_t>(state_count);
+                    return state_count++;
+                }
+
+                if (std::equal(set, set + words, sets.data() + table[slot] * words))
+                    return table[slot];
+            }
+        };
+
+        find_or_add();
+        find_or_add();
+
+        regex_buffer<uint64_t> reachable(words);
+
+        for (size_t state = 0; state < state_count; ++state)
+        {
+            std::fill_n(reachable.data(), words, 0u);
+            for_each_position(sets.data() + state * words,
+                              [&](size_t const pos)
+                              {
+                                  unite(reachable.data(), follow.data() + pos * words);
+                              });
+
+            for (size_t cls = 0; cls < class_count; ++cls)
+            {
+                uint64_t const * const signature = signatures.data() + class_representative[cls] * words;
+                size_t const next_set = sets.size();
+                sets.append(words, 0u);
+
+                for (size_t i = 0; i < words; ++i)
+                    sets[next_set + i] = reachable[i] & signature[i];
+
+                size_t const next = find_or_add();
+
+                if (state_count > max_states)
+                {
+                    fail(regex_status::too_complex);
+                    return;
+                }
+
+                sets.truncate(state_count * words); // Removes the set if it was known before.
+                dfa.transitions.push_back(static_cast<uint32_t>(next));
+            }
+        }
+
+        dfa.state_count = state_count;
+
+        for (size_t state = 0; state < state_count; ++state)
+        {
+            uint64_t const * const set = sets.data() + state * words;
+            bool accepting{false};
+
+            for (size_t i = 0; i < words; ++i)
+                accepting = accepting || (set[i] & final_positions[i]) != 0u;
+
+            dfa.accepting.push_back(accepting);
+        }
+    }
+    //!\}
+};
+
+/*!\brief A string that can be used as a template argument.
+ * \ingroup misc
+ * \tparam size The size of the string literal, including the terminating null character.
+ */
+template <size_t size>
+struct fixed_string
+{
+    //!\brief The characters, including the terminating null character.
+    std::array<char, size> characters{};
+
+    //!\brief Constructs from a string literal.
+    constexpr fixed_string(char const (&literal)[size]) noexcept
+    {
+        std::copy_n(literal, size, characters.data());
+    }
+
+    //!\brief Returns the string without the terminating null character.
+    constexpr std::string_view view() const noexcept
+    {
+        return {characters.data(), size - 1u};
+    }
+};
+
+/*!\brief A regular expression that is compiled into a deterministic finite automaton at compile time.
+ * \ingroup misc
+ * \tparam pattern The pattern; see sharg::detail::regex_compiler for the supported syntax.
+ *
+ * \details
+ *
+ * Unsupported and invalid patterns are rejected at compile time. The tables are stored in static arrays, i.e.
+ * matching needs neither a std::regex nor any allocation.
+ */
+template <fixed_string pattern>
+class static_regex
+{
+private:
+    //!\brief The status and dimensions of the automaton.
+    struct dimensions_type
+    {
+        regex_status status;  //!< The status of the compilation.
+        size_t class_count;   //!< The number of byte classes.
+        size_t state_count;   //!< The number of states.
+    };
+
+    //!\brief The status and dimensions of the automaton.
+    static constexpr dimensions_type dimensions = []()
+    {
+        regex_dfa const dfa = regex_compiler{pattern.view()}.compile();
+        return dimensions_type{dfa.status, dfa.class_count, dfa.state_count};
+    }();
+
+    static_assert(dimensions.status != regex_status::invalid, "The pattern is not a valid regular expression.");
+    static_assert(dimensions.status != regex_status::unsupported,
+                  "The pattern uses a feature that is not supported, e.g. back-references or assertions.");
+    static_assert(dimensions.status != regex_status::too_complex, "The automaton of the pattern is too large.");
+
+    //!\brief The type of a state.
+    using state_type = std::conditional_t<(dimensions.state_count <= 256u), uint8_t, uint16_t>;
+
+    //!\brief The tables of the automaton.
+    struct tables_type
+    {
+        //!\brief Maps each byte to its byte class.
+        std::array<uint8_t, 256> byte_class{};
+        //!\brief The transition table (state * class_count + class).
+        std::array<state_type, dimensions.state_count * dimensions.class_count> transitions{};
+        //!\brief Whether a state is accepting.
+        std::array<bool, dimensions.state_count> accepting{};
+    };
+
+    //!\brief The tables of the automaton.
+    static constexpr tables_type tables = []()
+    {
+        regex_dfa const dfa = regex_compiler{pattern.view()}.compile();
+        tables_type result{};
+        result.byte_class = dfa.byte_class;
+
+        for (size_t i = 0; i < result.transitions.size(); ++i)
+            result.transitions[i] = static_cast<state_type>(dfa.transitions[i]);
+
+        for (size_t i = 0; i < result.accepting.size(); ++i)
+            result.accepting[i] = dfa.accepting[i];
+
+        return result;
+    }();
+
+public:
+    //!\brief Whether the complete string `str` matches the pattern.
+    static constexpr bool match(std::string_view const str) noexcept
+    {
+        return regex_walk(str, tables.byte_class, dimensions.class_count, tables.transitions, tables.accepting, true)
+            != std::string_view::npos;
+    }
+
+    //!\brief Returns the length of the longest prefix of `str` that matches the pattern or std::string_view::npos.
+    static constexpr size_t longest_prefix(std::string_view const str) noexcept
+    {
+        return regex_walk(str, tables.byte_class, dimensions.class_count, tables.transitions, tables.accepting, false);
+    }
+};
+
+} // namespace sharg::detail
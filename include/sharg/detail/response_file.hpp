@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::response_file_expander.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sharg/auxiliary.hpp>
+#include <sharg/detail/mapped_file.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Splits the content of a response file into arguments, removing quotes and escapes in place.
+ * \ingroup parser
+ * \tparam callback_t The type of the callback; must be invocable with a std::string_view.
+ * \param[in,out] first The first character of the content.
+ * \param[in] last Behind the last character of the content.
+ * \param[in] syntax The quoting syntax; must not be sharg::response_file_syntax::none.
+ * \param[in] callback Is called with each argument in order.
+ *
+ * \details
+ *
+ * Arguments are separated by whitespace. Unquoted arguments are passed as views into the content as is; only
+ * arguments containing quotes or escapes are rewritten. Since removing quotes only shortens an argument, it is
+ * rewritten in place, hence unmodified pages of a sharg::detail::mapped_file are never copied.
+ */
+template <typename callback_t>
+void tokenize_response_file(char * first, char * const last, response_file_syntax const syntax, callback_t && callback)
+{
+    auto is_space = [](char const chr)
+    {
+        return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r' || chr == '\v' || chr == '\f';
+    };
+
+    char * it = first;
+
+    while (true)
+    {
+        it = std::find_if_not(it, last, is_space);
+
+        if (it == last)
+            return;
+
+        char * const token_first = it;
+        char * out = it;
+
+        auto emit = [&out, &it](char const chr)
+        {
+            if (out != it) // Do not touch the page if nothing changes.
+                *out = chr;
+            ++out;
+        };
+
+        char quote{'\0'};
+
+        if (syntax == response_file_syntax::gnu)
+        {
+            for (; it != last && (quote != '\0' || !is_space(*it)); ++it)
+            {
+                if (*it == '\\')
+                {
+                    if (++it == last)
+                        break;
+                    *out++ = *it; // out < it
+                }
+                else if (quote != '\0' && *it == quote)
+                {
+                    quote = '\0';
+                }
+                else if (quote == '\0' && (*it == '\'' || *it == '"'))
+                {
+                    quote = *it;
+                }
+                else
+                {
+                    emit(*it);
+                }
+            }
+        }
+        else // windows
+        {
+            for (; it != last && (quote != '\0' || !is_space(*it)); ++it)
+            {
+                if (*it == '\\')
+                {
+                    char * const backslashes_first = it;
+                    it = std::find_if(it, last,
+                                      [](char const chr)
+                                      {
+                                          return chr != '\\';
+                                      });
+                    size_t const count = static_cast<size_t>(it - backslashes_first);
+
+                    if (it == last || *it != '"') // Backslashes are literal if they do not precede a quote.
+                    {
+                        out = (out == backslashes_first) ? out + count : std::fill_n(out, count, '\\');
+                        --it;
+                        continue;
+                    }
+
+                    out = std::fill_n(out, count / 2u, '\\');
+
+                    if (count % 2u == 1u) // An escaped quote.
+                    {
+                        *out++ = '"';
+                        continue;
+                    }
+                    // Otherwise, the quote is handled below.
+                }
+
+                if (*it == '"')
+                {
+                    if (quote != '\0' && it + 1 != last && it[1] == '"') // "" within quotes is a literal quote.
+                    {
+                        *out++ = *++it;
+                    }
+                    else
+                    {
+                        quote = quote == '\0' ? '"' : '\0';
+                    }
+                }
+                else
+                {
+                    emit(*it);
+                }
+            }
+        }
+
+        callback(std::string_view{token_first, static_cast<size_t>(out - token_first)});
+    }
+}
+
+/*!\brief Expands response files (`@file`) in the command line arguments.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Each argument `@file` is replaced by the arguments read from `file`. Arguments read from a response file may
+ * again be response files. As in GCC, relative paths are relative to the working directory, and an argument
+ * `@file` whose file does not exist is kept as is. Arguments after the first `--` are never expanded.
+ *
+ * The files are mapped into memory (see sharg::detail::mapped_file) and stay mapped for the lifetime of the
+ * expander; the expanded arguments are views into these mappings.
+ */
+class response_file_expander
+{
+public:
+    /*!\brief Expands all response files in `arguments`.
+     * \param[in,out] arguments The arguments; the first argument (the executable) is never expanded.
+     * \param[in] syntax The quoting syntax of the response files.
+     * \throws sharg::user_input_error if a response file cannot be read or includes itself.
+     */
+    void expand(std::vector<std::string_view> & arguments, response_file_syntax const syntax)
+    {
+        auto end_of_options = std::ranges::find(arguments, std::string_view{"--"});
+
+        if (syntax == response_file_syntax::none || arguments.empty()
+            || std::none_of(arguments.begin() + 1,
+                            end_of_options,
+                            [](std::string_view const arg)
+                            {
+                                return arg.starts_with('@');
+                            }))
+        {
+            return;
+        }
+
+        std::vector<std::string_view> expanded{};
+        expanded.reserve(arguments.size());
+        expanded.push_back(arguments.front());
+        bool options_ended{false};
+
+        for (std::string_view const arg : arguments | std::views::drop(1))
+            expand_argument(arg, syntax, expanded, options_ended);
+
+        arguments = std::move(expanded);
+    }
+
+private:
+    //!\brief The files that have been expanded.
+    std::vector<mapped_file> files{};
+    //!\brief The canonical paths of the files that are currently being expanded.
+    std::vector<std::filesystem::path> active_files{};
+
+    //!\brief Appends `arg` or, if it is a response file, its expanded content to `expanded`.
+    void expand_argument(std::string_view const arg,
+                         response_file_syntax const syntax,
+                         std::vector<std::string_view> & expanded,
+                         bool & options_ended)
+    {
+        std::error_code error{};
+        std::filesystem::path path{};
+
+        if (!options_ended && arg.starts_with('@'))
+        {
+            path = std::filesystem::path{arg.substr(1)};
+
+            if (!std::filesystem::exists(path, error))
+                path.clear();
+        }
+
+        if (path.empty())
+        {
+            options_ended = options_ended || arg == "--";
+            expanded.push_back(arg);
+            return;
+        }
+
+        path = std::filesystem::weakly_canonical(path);
+
+        if (std::ranges::find(active_files, path) != active_files.end())
+            throw user_input_error{"The response file " + std::string{arg.substr(1)} + " includes itself."};
+
+        mapped_file & file = files.emplace_back(path, "response file");
+        active_files.push_back(path);
+
+        tokenize_response_file(file.begin(),
+                               file.end(),
+                               syntax,
+                               [&](std::string_view const token)
+                               {
+                                   expand_argument(token, syntax, expanded, options_ended);
+                               });
+
+        active_files.pop_back();
+    }
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::suffix_matcher.
+ */
+
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sharg::detail
+{
+
+/*!\brief Checks whether a string ends with one of several suffixes, ignoring the case.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * The suffixes are stored reversed and in lower case in a trie, i.e. a string is only read once from the back,
+ * independent of the number of suffixes.
+ */
+class suffix_matcher
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    suffix_matcher() = default; //!< Defaulted.
+
+    //!\brief Constructs the trie of `suffixes`.
+    explicit suffix_matcher(std::vector<std::string> const & suffixes) : suffix_count{suffixes.size()}
+    {
+        for (std::string const & suffix : suffixes)
+        {
+            uint32_t current{0u};
+
+            for (auto it = suffix.rbegin(); it != suffix.rend(); ++it)
+            {
+                char const chr = to_lower(*it);
+                uint32_t child = find_child(current, chr);
+
+                if (child == no_node)
+                {
+                    child = static_cast<uint32_t>(nodes.size());
+                    nodes.push_back(node{.label = chr, .next_sibling = nodes[current].first_child});
+                    nodes[current].first_child = child;
+                }
+
+                current = child;
+            }
+
+            nodes[current].is_suffix = true;
+        }
+    }
+    //!\}
+
+    //!\brief Returns the number of suffixes.
+    size_t size() const noexcept
+    {
+        return suffix_count;
+    }
+
+    //!\brief Whether `str` ends with one of the suffixes, ignoring the case.
+    bool matches(std::string_view const str) const noexcept
+    {
+        uint32_t current{0u};
+
+        for (auto it = str.rbegin(); !nodes[current].is_suffix; ++it)
+        {
+            if (it == str.rend() || (current = find_child(current, to_lower(*it))) == no_node)
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    //!\brief Marks a missing child or sibling.
+    static constexpr uint32_t no_node{0u}; // The root is never a child.
+
+    //!\brief A node of the trie.
+    struct node
+    {
+        char label{};            //!< The character of the edge to this node.
+        bool is_suffix{false};   //!< Whether the path from the root to this node spells a (reversed) suffix.
+        uint32_t first_child{};  //!< The first child or no_node.
+        uint32_t next_sibling{}; //!< The next sibling or no_node.
+    };
+
+    //!\brief The nodes; the first node is the root.
+    std::vector<node> nodes{node{}};
+    //!\brief The number of suffixes.
+    size_t suffix_count{};
+
+    //!\brief Converts `chr` to lower case.
+    static char to_lower(char const chr) noexcept
+    {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(chr)));
+    }
+
+    //!\brief Returns the child of `parent` with label `chr` or no_node.
+    uint32_t find_child(uint32_t const parent, char const chr) const noexcept
+    {
+        uint32_t child = nodes[parent].first_child;
+
+        while (child != no_node && nodes[child].label != chr)
+            child = nodes[child].next_sibling;
+
+        return child;
+    }
+};
+
+} // namespace sharg::detail
@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include <charconv>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <version>
 
 #include <sharg/concept.hpp>
 #include <sharg/detail/concept.hpp>
@@ -29,19 +33,85 @@ static std::string const supported_exports =
 template <typename container_t>
 concept is_ostreamable_view = std::ranges::view<container_t> && ostreamable<std::ranges::range_value_t<container_t>>;
 
-/*!\brief Streams all parameters via std::ostringstream and returns a concatenated string.
+/*!\brief Whether std::to_chars supports floating point numbers.
+ * \ingroup misc
+ */
+#if defined(__cpp_lib_to_chars)
+inline constexpr bool floating_point_to_chars = true;
+#else
+inline constexpr bool floating_point_to_chars = false;
+#endif
+
+//!\brief Concept for arithmetic types that are formatted with std::to_chars instead of a stream.
+template <typename number_t>
+concept chars_formattable = (std::integral<number_t> && !std::same_as<number_t, bool> && !std::same_as<number_t, char>)
+                         || (floating_point_to_chars && std::floating_point<number_t>);
+
+/*!\brief Appends a number to `target` as `stream << number` would print it.
+ * \ingroup misc
+ * \details Floating point numbers are printed with six significant digits, which is the default of a stream.
+ */
+template <chars_formattable number_t>
+void append_number(std::string & target, number_t const number)
+{
+    char buffer[64];
+    std::to_chars_result result{};
+
+    if constexpr (std::floating_point<number_t>)
+        result = std::to_chars(buffer, buffer + sizeof(buffer), number, std::chars_format::general, 6);
+    else
+        result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+
+    target.append(buffer, result.ptr);
+}
+
+/*!\brief Appends a value to `target` as `stream << value` would print it.
+ * \ingroup misc
+ * \details Characters, strings and numbers are appended directly; all other types are streamed.
+ */
+template <typename value_t>
+    requires ostreamable<value_t>
+void append_streamed(std::string & target, value_t const & value)
+{
+    if constexpr (std::same_as<value_t, char> || std::same_as<value_t, signed char>
+                  || std::same_as<value_t, unsigned char>)
+    {
+        target.push_back(static_cast<char>(value));
+    }
+    else if constexpr (std::same_as<value_t, bool>)
+    {
+        target.push_back(value ? '1' : '0');
+    }
+    else if constexpr (chars_formattable<value_t>)
+    {
+        append_number(target, value);
+    }
+    else if constexpr (std::convertible_to<value_t const &, std::string_view>)
+    {
+        target.append(std::string_view{value});
+    }
+    else
+    {
+        std::ostringstream stream{};
+        stream << value;
+        target.append(stream.str());
+    }
+}
+
+/*!\brief Prints all parameters as if streamed via std::ostringstream and returns a concatenated string.
  * \ingroup misc
  * \tparam    value_types Must be sharg::ostreamable (stream << value).
  * \param[in] values     Variable number of parameters of any type that implement the stream operator.
  * \returns A concatenated string of all values (no separator in between is added).
+ * \details Strings and numbers are appended without a stream, see sharg::detail::append_streamed.
  */
 template <typename... value_types>
     requires (ostreamable<value_types> && ...)
 std::string to_string(value_types &&... values)
 {
-    std::stringstream stream;
+    std::string result{};
 
-    auto print = [&stream](auto && val)
+    auto print = [&result](auto && val)
     {
         using value_t = std::remove_cvref_t<decltype(val)>;
 
@@ -51,31 +121,34 @@ std::string to_string(value_types &&... values)
         {
             if (val.empty())
             {
-                stream << "[]";
+                result.append("[]");
             }
             else
             {
-                stream << '[';
+                result.push_back('[');
                 auto it = val.begin();
-                stream << *it++;
+                append_streamed(result, *it++);
                 for (; it != val.end(); ++it)
-                    stream << ", " << *it;
-                stream << ']';
+                {
+                    result.append(", ");
+                    append_streamed(result, *it);
+                }
+                result.push_back(']');
             }
         }
         else if constexpr (std::is_same_v<value_t, int8_t> || std::is_same_v<value_t, uint8_t>)
         {
-            stream << static_cast<int16_t>(val);
+            append_number(result, static_cast<int16_t>(val));
         }
         else
         {
-            stream << val;
+            append_streamed(result, val);
         }
     };
 
     (print(std::forward<value_types>(values)), ...);
 
-    return stream.str();
+    return result;
 }
 
 } // namespace sharg::detail
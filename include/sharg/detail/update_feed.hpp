@@ -0,0 +1,514 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::update_feed.
+ */
+
+#pragma once
+
+#if !defined(_WIN32)
+#    include <fcntl.h>
+#    include <signal.h>
+#    include <spawn.h>
+#    include <unistd.h>
+
+#    include <sys/socket.h>
+#    include <sys/time.h>
+#    include <sys/un.h>
+#    include <sys/wait.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sharg/detail/regex.hpp>
+
+namespace sharg::detail
+{
+
+// ------------------------------------------------------------------------------------------------------------------
+// class version_check_cancellation
+// ------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Lets the owner of a version check stop the downloader, see sharg::detail::run_program.
+ * \ingroup parser
+ * \details
+ *
+ * The object is shared by the sharg::parser and the detached thread that runs the downloader. Cancelling kills the
+ * downloader if it runs and prevents that it is started. On Windows, the download cannot be cancelled.
+ */
+class version_check_cancellation
+{
+public:
+    //!\brief Kills the downloader if it runs and prevents that it is started.
+    void cancel()
+    {
+        std::lock_guard lock{mutex};
+        cancelled = true;
+#if !defined(_WIN32)
+        if (pid > 0)
+        {
+            kill(pid, SIGKILL);
+            interrupted = true;
+        }
+#endif
+    }
+
+    //!\brief Whether cancel() killed the downloader or prevented that it was started.
+    bool was_interrupted()
+    {
+        std::lock_guard lock{mutex};
+        return interrupted;
+    }
+
+#if !defined(_WIN32)
+    /*!\brief Returns `spawn()`, the process ID of a new process, or -1 if cancelled.
+     * \details
+     * The process may be killed by cancel() until finish() is called.
+     */
+    template <typename spawn_t>
+    pid_t start(spawn_t && spawn)
+    {
+        std::lock_guard lock{mutex};
+
+        if (!cancelled)
+            pid = spawn();
+        else
+            interrupted = true;
+
+        return cancelled ? -1 : pid;
+    }
+
+    //!\brief Prevents that the process is killed; must be called after it exited and before it is reaped.
+    void finish()
+    {
+        std::lock_guard lock{mutex};
+        pid = -1;
+    }
+#endif
+
+private:
+    //!\brief Guards `cancelled`, `interrupted` and `pid`.
+    std::mutex mutex{};
+    //!\brief Whether cancel() was called.
+    bool cancelled{false};
+    //!\brief Whether cancel() killed the downloader or prevented that it was started.
+    bool interrupted{false};
+#if !defined(_WIN32)
+    //!\brief The ID of the running process, or -1 if there is none.
+    pid_t pid{-1};
+#endif
+};
+
+// ------------------------------------------------------------------------------------------------------------------
+// function replace_file()
+// ------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Replaces a file via rename, such that concurrent readers never see a partially written file.
+ * \ingroup parser
+ * \param[in] file              The file.
+ * \param[in] content           The new content.
+ * \param[in] modification_time The modification time of the new file; the current time if unset.
+ * \returns Whether the file was replaced.
+ */
+inline bool replace_file(std::filesystem::path const & file,
+                         std::string_view const content,
+                         std::optional<std::filesystem::file_time_type> const modification_time = std::nullopt)
+{
+    std::filesystem::path temporary{file};
+    temporary += ".tmp" + std::to_string(std::random_device{}());
+
+    std::ofstream stream{temporary};
+    stream << content;
+    stream.close();
+
+    std::error_code error{};
+
+    if (stream.good() && modification_time.has_value())
+        std::filesystem::last_write_time(temporary, *modification_time, error);
+
+    if (stream.good() && !error)
+        std::filesystem::rename(temporary, file, error);
+
+    if (!stream.good() || error)
+    {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    return true;
+}
+
+#if !defined(_WIN32)
+/*!\brief Runs a program without environment variables and without input and output, and waits until it exited.
+ * \ingroup parser
+ * \param[in] arguments    The absolute path of the program followed by its arguments.
+ * \param[in] cancellation Kills the program when cancelled.
+ * \returns Whether the program was started and exited with status 0.
+ *
+ * \details
+ *
+ * The program is started via `posix_spawn`, i.e. neither a shell nor a copy of the calling process is started.
+ * The empty environment corresponds to `/usr/bin/env -i`.
+ */
+inline bool run_program(std::vector<std::string> const & arguments, version_check_cancellation & cancellation)
+{
+    std::vector<char *> argv{};
+    argv.reserve(arguments.size() + 1u);
+
+    for (std::string const & argument : arguments)
+        argv.push_back(const_cast<char *>(argument.c_str()));
+
+    argv.push_back(nullptr);
+    char * environment[] = {nullptr};
+
+    posix_spawn_file_actions_t actions{};
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+    pid_t const pid = cancellation.start(
+        [&]()
+        {
+            pid_t pid{};
+            return posix_spawn(&pid, argv[0], &actions, nullptr, argv.data(), environment) == 0 ? pid : -1;
+        });
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (pid == -1)
+        return false;
+
+    // Wait without reaping the process such that cancel() cannot kill another process with the same ID.
+    siginfo_t info{};
+    while (waitid(P_PID, pid, &info, WEXITED | WNOWAIT) == -1 && errno == EINTR)
+    {}
+
+    cancellation.finish();
+
+    int status{};
+    while (waitpid(pid, &status, 0) == -1)
+    {
+        if (errno != EINTR)
+            return false;
+    }
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+//!\overload
+inline bool run_program(std::vector<std::string> const & arguments)
+{
+    version_check_cancellation cancellation{};
+    return run_program(arguments, cancellation);
+}
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------
+// struct downloader
+// ------------------------------------------------------------------------------------------------------------------
+
+/*!\brief A program that downloads a URL into a file, e.g. `wget`.
+ * \ingroup parser
+ */
+struct downloader
+{
+    //!\brief The name of the program.
+    std::string_view name{};
+    //!\brief The options that precede the output file and the URL.
+    std::vector<std::string> options{};
+    //!\brief The absolute path of the program; empty if it was not found.
+    std::filesystem::path path{};
+};
+
+// ------------------------------------------------------------------------------------------------------------------
+// class update_feed
+// ------------------------------------------------------------------------------------------------------------------
+
+/*!\brief Provides the version information for the version check, i.e. the content of the version file.
+ * \ingroup parser
+ * \details
+ *
+ * A feed is given by a URL, to which the query of the sharg::detail::version_checker is appended, e.g.
+ * `SeqAn-Sharg_Linux_64_app_1.0.0`:
+ *
+ * * `https://` and `http://`: The URL is downloaded by a downloader, see sharg::detail::run_program. The default
+ *   feed is sharg::detail::update_feed::default_url. Only alphanumeric characters and `:/._~%+-` are allowed.
+ * * `file://`: The file `{path}{query}` is read, e.g. `file:///srv/sharg/` reads `/srv/sharg/SeqAn-Sharg_Linux_...`.
+ * * `unix://`: The path is a unix domain socket, e.g. `unix:///run/sharg.sock`, on which an HTTP server answers
+ *   `GET /{query}`. Not available on Windows.
+ *
+ * Furthermore, a feed may be a function, e.g. to test the version check without a server.
+ */
+class update_feed
+{
+public:
+    //!\brief The type of a function that returns the version information for a query or std::nullopt.
+    using function_type = std::function<std::optional<std::string>(std::string const & query)>;
+
+    //!\brief The URL of the SeqAn update server.
+    static constexpr std::string_view default_url{"https://seqan-update.cs.uni-tuebingen.de/check/"};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    update_feed() = default;                                //!< Defaulted.
+    update_feed(update_feed const &) = default;             //!< Defaulted.
+    update_feed & operator=(update_feed const &) = default; //!< Defaulted.
+    update_feed(update_feed &&) = default;                  //!< Defaulted.
+    update_feed & operator=(update_feed &&) = default;      //!< Defaulted.
+    ~update_feed() = default;                               //!< Defaulted.
+
+    //!\brief Constructs a feed from a URL; see is_valid().
+    explicit update_feed(std::string url_) : url{std::move(url_)}
+    {}
+
+    //!\brief Constructs a feed that calls `function_`.
+    explicit update_feed(function_type function_) : function{std::move(function_)}
+    {}
+    //!\}
+
+    /*!\brief Returns the feed given by the environment variable `SHARG_UPDATE_FEED`, or else by `url`, or else the
+     *        default feed.
+     * \param[in] url The feed chosen by the application, e.g. see sharg::parser::set_update_feed; may be empty.
+     */
+    static update_feed select(std::string const & url)
+    {
+        if (char const * const env = std::getenv("SHARG_UPDATE_FEED"); env != nullptr && *env != '\0')
+            return update_feed{std::string{env}};
+
+        return url.empty() ? update_feed{} : update_feed{url};
+    }
+
+    //!\brief Whether the feed is a function or a URL with a supported scheme.
+    bool is_valid() const
+    {
+        return function != nullptr || kind() != scheme::unknown;
+    }
+
+    //!\brief Whether the feed is accessed via the network, i.e. via a downloader.
+    bool is_remote() const
+    {
+        return function == nullptr && kind() == scheme::http;
+    }
+
+    /*!\brief Writes the version information for `query` to `version_file`.
+     * \param[in] query        The query, see sharg::detail::version_checker.
+     * \param[in] version_file The file; replaced via rename once the version information is complete.
+     * \param[in] program      The downloader of a remote feed, see is_remote(); unused on Windows.
+     * \param[in] cancellation Kills the downloader when cancelled.
+     * \returns Whether the version information was written.
+     */
+    bool fetch(std::string const & query,
+               std::filesystem::path const & version_file,
+               downloader const & program,
+               version_check_cancellation & cancellation) const
+    {
+        if (function != nullptr)
+        {
+            std::optional<std::string> const content = function(query);
+            return content.has_value() && replace_file(version_file, *content);
+        }
+
+        std::string const location = url.substr(url.find("://") + 3u) + query;
+
+        switch (kind())
+        {
+        case scheme::http:
+            return download(url + query, version_file, program, cancellation);
+        case scheme::file:
+        {
+            std::ifstream stream{location, std::ios::binary};
+            std::string const content{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+            return stream.is_open() && !stream.bad() && replace_file(version_file, content);
+        }
+#if !defined(_WIN32)
+        case scheme::unix_socket:
+        {
+            std::optional<std::string> const content = request(location.substr(0, location.size() - query.size()),
+                                                                "/" + query);
+            return content.has_value() && replace_file(version_file, *content);
+        }
+#endif
+        default:
+            return false;
+        }
+    }
+
+private:
+    //!\brief The kinds of feeds given by a URL.
+    enum class scheme : uint8_t
+    {
+        unknown,     //!< Not supported.
+        http,        //!< `https://` or `http://`
+        file,        //!< `file://`
+        unix_socket, //!< `unix://`
+    };
+
+    //!\brief The characters allowed in the URL of a remote feed; it is passed to the downloader.
+    using url_regex = static_regex<"^https?://[a-zA-Z0-9:/._~%+-]+$">;
+
+    //!\brief The URL; unused if `function` is set.
+    std::string url{default_url};
+    //!\brief The function that provides the version information, if any.
+    function_type function{};
+
+    //!\brief Returns the scheme of `url`.
+    scheme kind() const
+    {
+        if (url_regex::match(url))
+            return scheme::http;
+
+        if (url.starts_with("file://"))
+            return scheme::file;
+
+#if !defined(_WIN32)
+        if (url.starts_with("unix://"))
+            return scheme::unix_socket;
+#endif
+
+        return scheme::unknown;
+    }
+
+    //!\brief Downloads `source` into `version_file` via the partial file `version_file.part*`.
+    static bool download(std::string const & source,
+                         std::filesystem::path const & version_file,
+                         [[maybe_unused]] downloader const & program,
+                         [[maybe_unused]] version_check_cancellation & cancellation)
+    {
+        std::filesystem::path partial_file{version_file};
+        partial_file += ".part" + std::to_string(std::random_device{}());
+
+#if defined(_WIN32)
+        std::string const command = "powershell.exe -NoLogo -NonInteractive -Command \"& {Invoke-WebRequest "
+                                    "-erroraction 'silentlycontinue' -OutFile "
+                                  + partial_file.string() + " " + source + "; exit  [int] -not $?}\" > nul 2>&1";
+        bool const success = system(command.c_str()) == 0;
+#else
+        if (program.path.empty())
+            return false;
+
+        std::vector<std::string> arguments{program.path.string()};
+        arguments.insert(arguments.end(), program.options.begin(), program.options.end());
+        arguments.push_back(partial_file.string());
+        arguments.push_back(source);
+
+        bool const success = run_program(arguments, cancellation);
+#endif
+
+        std::error_code error{};
+
+        if (success)
+            std::filesystem::rename(partial_file, version_file, error);
+
+        if (!success || error)
+        {
+            std::filesystem::remove(partial_file, error);
+            return false;
+        }
+
+        return true;
+    }
+
+#if !defined(_WIN32)
+    /*!\brief Returns the body of the response to `GET target` from an HTTP server listening on a unix domain socket.
+     * \param[in] socket_path The path of the socket.
+     * \param[in] target      The request target, e.g. `/SeqAn-Sharg_Linux_64_app_1.0.0`.
+     * \returns The body, or std::nullopt if the request failed or the status is not 200.
+     */
+    static std::optional<std::string> request(std::string const & socket_path, std::string const & target)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+
+        if (socket_path.size() >= sizeof(address.sun_path))
+            return std::nullopt;
+
+        std::memcpy(address.sun_path, socket_path.data(), socket_path.size());
+
+        int const socket_file = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (socket_file == -1)
+            return std::nullopt;
+
+        std::string response{};
+        std::string const message = "GET " + target + " HTTP/1.0\r\nHost: localhost\r\n\r\n";
+        bool const sent = exchange(socket_file, address, message, response);
+        ::close(socket_file);
+
+        // The status line is, e.g., "HTTP/1.0 200 OK".
+        size_t const body = response.find("\r\n\r\n");
+
+        if (!sent || body == std::string::npos || !response.starts_with("HTTP/1.")
+            || response.compare(8, 5, " 200 ") != 0)
+        {
+            return std::nullopt;
+        }
+
+        return response.substr(body + 4u);
+    }
+
+    //!\brief Connects `socket_file` to `address`, sends `message` and receives `response` until the server closes.
+    static bool exchange(int const socket_file,
+                         sockaddr_un const & address,
+                         std::string_view message,
+                         std::string & response)
+    {
+        // The server must respond within 10 seconds, like the downloaders, see version_checker::find_downloader.
+        timeval const timeout{.tv_sec = 10, .tv_usec = 0};
+        ::setsockopt(socket_file, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        ::setsockopt(socket_file, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        if (::connect(socket_file, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0)
+            return false;
+
+#    if defined(MSG_NOSIGNAL)
+        int const flags{MSG_NOSIGNAL};
+#    else
+        int const flags{0};
+#    endif
+
+        while (!message.empty())
+        {
+            ssize_t const written = ::send(socket_file, message.data(), message.size(), flags);
+
+            if (written < 0 && errno != EINTR)
+                return false;
+
+            message.remove_prefix(std::max<ssize_t>(written, 0));
+        }
+
+        std::array<char, 4096> buffer{};
+
+        while (true)
+        {
+            ssize_t const received = ::recv(socket_file, buffer.data(), buffer.size(), 0);
+
+            if (received == 0)
+                return true;
+
+            if (received < 0 && errno != EINTR)
+                return false;
+
+            response.append(buffer.data(), std::max<ssize_t>(received, 0));
+        }
+    }
+#endif
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::detail::validation_executor.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <sharg/detail/deadline.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Runs the validations of a parsed command line on background threads.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The validations are added in the order in which sharg::detail::format_parse parses the values, i.e. the order in
+ * which they would have been run synchronously. start() runs them concurrently on up to
+ * sharg::detail::validation_executor::max_threads threads, and wait() rethrows the exception of the first failed
+ * validation in that order. Hence, the error message is the same as if the values were validated synchronously.
+ * Validations after the first failed one are skipped.
+ *
+ * If wait() was not called, unobserved_error() returns the exception that wait() would have thrown, such that the
+ * owner can report it instead of losing it.
+ *
+ * The threads inherit the timeout of the thread that calls start(), see sharg::detail::deadline.
+ */
+class validation_executor
+{
+public:
+    //!\brief The maximal number of threads.
+    static constexpr size_t max_threads{4u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    validation_executor() = default;                                       //!< Defaulted.
+    validation_executor(validation_executor const &) = delete;             //!< Deleted.
+    validation_executor & operator=(validation_executor const &) = delete; //!< Deleted.
+
+    //!\brief Skips the validations that did not start yet and waits for the running ones.
+    ~validation_executor()
+    {
+        first_error = 0u;
+    }
+    //!\}
+
+    //!\brief Adds a validation; must not be called after start().
+    void add(std::function<void()> validation)
+    {
+        validations.push_back(std::move(validation));
+    }
+
+    //!\brief Starts running the validations.
+    void start()
+    {
+        errors.resize(validations.size());
+        first_error = validations.size();
+
+        size_t const hardware_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+        size_t const thread_count = std::min({max_threads, hardware_threads, validations.size()});
+        threads.reserve(thread_count);
+
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back(
+                [this, timeout = deadline::timeout()]()
+                {
+                    deadline::scope const deadline_scope{timeout};
+                    run();
+                });
+        }
+    }
+
+    /*!\brief Waits until all validations finished.
+     * \throws The exception of the first failed validation.
+     */
+    void wait()
+    {
+        threads.clear(); // Joins the threads.
+        observed = true;
+
+        if (first_error < errors.size())
+            std::rethrow_exception(errors[first_error]);
+    }
+
+    /*!\brief Waits until all validations finished and returns the exception of the first failed one, unless it was
+     *        already thrown by wait().
+     * \returns The exception, or `nullptr` if all validations succeeded, none was started, or wait() was called.
+     */
+    std::exception_ptr unobserved_error()
+    {
+        if (observed)
+            return nullptr;
+
+        threads.clear(); // Joins the threads.
+        observed = true;
+        return first_error < errors.size() ? errors[first_error] : nullptr;
+    }
+
+private:
+    //!\brief The validations in parsing order.
+    std::vector<std::function<void()>> validations{};
+    //!\brief The exception of each validation; empty if the validation succeeded or did not run.
+    std::vector<std::exception_ptr> errors{};
+    //!\brief The index of the next validation to run.
+    std::atomic<size_t> next_validation{0u};
+    //!\brief The index of the first failed validation, or the number of validations if none failed.
+    std::atomic<size_t> first_error{std::numeric_limits<size_t>::max()};
+    //!\brief Whether the result was returned by wait() or unobserved_error().
+    bool observed{false};
+    //!\brief The threads; declared last such that they are joined before the other members are destroyed.
+    std::vector<std::jthread> threads{};
+
+    //!\brief Runs validations until there are none left or a preceding validation failed.
+    void run()
+    {
+        size_t const validation_count = validations.size();
+
+        for (size_t i = next_validation++; i < validation_count && i < first_error.load(); i = next_validation++)
+        {
+            try
+            {
+                validations[i]();
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+
+                for (size_t error = first_error.load(); i < error && !first_error.compare_exchange_weak(error, i);)
+                {}
+            }
+        }
+    }
+};
+
+} // namespace sharg::detail
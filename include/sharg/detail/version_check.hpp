@@ -9,17 +9,29 @@
 
 #pragma once
 
+#if !defined(_WIN32)
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/file.h>
+#    include <sys/stat.h>
+#endif
+
 #include <array>
 #include <fstream>
 #include <future>
 #include <iostream>
+#include <memory>
 #include <optional>
-#include <regex>
+#include <string_view>
+#include <vector>
 #include <sharg/std/charconv>
 
 #include <sharg/auxiliary.hpp>
+#include <sharg/detail/regex.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
 #include <sharg/detail/terminal.hpp>
+#include <sharg/detail/update_feed.hpp>
 
 namespace sharg::detail
 {
@@ -28,20 +40,41 @@ namespace sharg::detail
 // function call_server()
 // ------------------------------------------------------------------------------------------------------------------
 
-/*!\brief Writes a timestamp file and performs the server call to get the newest version information.
+/*!\brief Performs the server call to get the newest version information.
  * \ingroup parser
- * \param[in] command  The system command as a string. See sharg::detail::version_checker::command for details.
- * \param[in] prom     A promise object used to track the detached thread which executes this command.
- *
- * This function performs a https server request by executing a hard coded command (string) as a system call.
+ * \param[in] feed         The update feed.
+ * \param[in] program      The downloader used for remote feeds, see sharg::detail::update_feed::is_remote().
+ * \param[in] query        The query, see sharg::detail::version_checker::operator().
+ * \param[in] version_file The file that stores the response.
+ * \param[in] offline_file The file that marks the host as offline; written if the downloader ran and failed, and
+ *                         removed if the server call succeeds.
+ * \param[in] cancellation Kills the downloader when cancelled.
+ * \param[in] prom         A promise object used to track the detached thread which executes the server call.
  */
-inline void call_server(std::string const & command, std::promise<bool> prom)
+inline void call_server(update_feed const & feed,
+                        downloader const & program,
+                        std::string const & query,
+                        std::filesystem::path const & version_file,
+                        std::filesystem::path const & offline_file,
+                        std::shared_ptr<version_check_cancellation> const cancellation,
+                        std::promise<bool> prom)
 {
-    // system call - http response is stored in a file '.config/seqan/{appname}_version'
-    if (system(command.c_str()))
-        prom.set_value(false);
-    else
-        prom.set_value(true);
+    // The response is stored in a file '.config/seqan/{appname}.version'.
+    bool const success = feed.fetch(query, version_file, program, *cancellation);
+
+    if (success)
+    {
+        std::error_code error{};
+        std::filesystem::remove(offline_file, error);
+    }
+    else if (feed.is_remote() && !cancellation->was_interrupted()) // A cancelled call does not tell anything.
+    {
+        namespace co = std::chrono;
+        int64_t const timestamp = co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
+        replace_file(offline_file, std::to_string(timestamp) + '\n');
+    }
+
+    prom.set_value(success);
 }
 
 // ------------------------------------------------------------------------------------------------------------------
@@ -73,7 +106,7 @@ public:
     version_checker(std::string name_, std::string const & version_, std::string const & app_url = std::string{}) :
         name{std::move(name_)}
     {
-        assert(std::regex_match(name, std::regex{"^[a-zA-Z0-9_-]+$"})); // check on construction of the parser
+        assert(static_regex<"^[a-zA-Z0-9_-]+$">::match(name)); // check on construction of the parser
 
         if (!app_url.empty())
         {
@@ -86,19 +119,19 @@ public:
 #else
         timestamp_filename = cookie_path / (name + "_dev.timestamp");
 #endif
-        std::smatch versionMatch;
+        // Ensure version string is not corrupt; a version prefix is allowed instead of an exact match.
+        size_t const version_length = version_regex::longest_prefix(version_);
 
-        // Ensure version string is not corrupt
-        if (!version_.empty() && /*regex allows version prefix instead of exact match */
-            std::regex_search(version_, versionMatch, std::regex("^([[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+).*")))
-        {
-            version = versionMatch.str(1); // in case the git revision number is given take only version number
-        }
+        // In case the git revision number is given, take only the version number.
+        if (version_length != std::string_view::npos)
+            version = version_.substr(0, version_length);
     }
     //!\}
 
     /*!\brief Initialises the version_checker with the application name and version.
-     * \param[in] prom The promise to track the state of the detached thread which calls sharg::detail::call_server.
+     * \param[in] prom         The promise to track the state of the detached thread which calls
+     *                          sharg::detail::call_server.
+     * \param[in] cancellation Stops the server call when cancelled; may be `nullptr`.
      *
      * The operator performs the following steps:
      *
@@ -122,8 +155,15 @@ public:
      *    **Release mode** (directed at the user of the application):
      *    * If the current app version is lower than the one returned by the server call, the user is notified that
      *      a newer version exists.
+     *
+     * 3. The update feed (see sharg::detail::version_checker::feed) is called in a detached thread. If the feed is
+     *    remote and the downloader ran and failed, the host is marked as offline for a day (file `offline` in the
+     *    cookie path) until a call succeeds, and no call is made while the host is marked as offline. Hence, on hosts
+     *    without network access, the downloader is started at most once per day. A call that is cancelled (see
+     *    sharg::detail::version_check_cancellation) or that does not finish before the process exits does not mark
+     *    the host as offline.
      */
-    void operator()(std::promise<bool> prom)
+    void operator()(std::promise<bool> prom, std::shared_ptr<version_check_cancellation> cancellation = nullptr)
     {
         std::array<int, 3> empty_version{0, 0, 0};
         std::array<int, 3> srv_app_version{};
@@ -174,50 +214,109 @@ public:
 
         std::cerr << std::flush;
 
-        std::string program = get_program();
+        // 'cookie_path' is no user input and `name` is escaped on construction of the parser.
+        std::filesystem::path const out_file = cookie_path / (name + ".version");
+        std::filesystem::path const offline_file = cookie_path / "offline";
+        downloader program{};
 
-        if (program.empty())
+        if (feed.is_remote())
         {
-            prom.set_value(false);
-            return;
-        }
+            if (is_offline(offline_file))
+            {
+                prom.set_value(false);
+                return;
+            }
 
-        // 'cookie_path' is no user input and `name` is escaped on construction of the parser.
-        std::filesystem::path out_file = cookie_path / (name + ".version");
+#if !defined(_WIN32)
+            program = find_downloader(cookie_path);
 
-        // build up command for server call
-        std::string command = program + // no user defined input
-                              " " + out_file.string() + " "
-                            + std::string{"https://seqan-update.cs.uni-tuebingen.de/check/SeqAn-Sharg_"} +
-#ifdef __linux
-                              "Linux" +
-#elif __APPLE__
-                              "MacOS" +
-#elif defined(_WIN32)
-                              "Windows" +
-#elif __FreeBSD__
-                              "FreeBSD" +
-#elif __OpenBSD__
-                              "OpenBSD" +
-#else
-                              "unknown" +
-#endif
-#if __x86_64__ || __ppc64__
-                              "_64_" +
-#else
-                              "_32_" +
-#endif
-                              name +          // !user input! escaped on construction of the parser
-                              "_" + version + // !user input! escaped on construction of the version_checker
-#if defined(_WIN32)
-                              "; exit  [int] -not $?}\" > nul 2>&1";
-#else
-                              " > /dev/null 2>&1";
+            if (program.path.empty())
+            {
+                prom.set_value(false);
+                return;
+            }
 #endif
+        }
+
+        if (cancellation == nullptr)
+            cancellation = std::make_shared<version_check_cancellation>();
 
         // launch a separate thread to not defer runtime.
-        std::thread(call_server, command, std::move(prom)).detach();
+        std::thread(call_server,
+                    feed,
+                    std::move(program),
+                    server_query(),
+                    out_file,
+                    offline_file,
+                    std::move(cancellation),
+                    std::move(prom))
+            .detach();
+    }
+
+#if !defined(_WIN32)
+    /*!\brief Returns the first available downloader, see sharg::detail::downloader.
+     * \param[in] cache_directory The directory of the cache file; no cache is used if empty.
+     *
+     * \details
+     *
+     * The directories in the environment variable `PATH` (default `/bin:/usr/bin`) are searched for `wget`, then
+     * `curl`, and on OpenBSD and FreeBSD for `ftp` and `fetch`. Relative directories are skipped. The result is
+     * cached in the file `downloader` in `cache_directory` and the cached program is used as long as it is
+     * executable and in a directory of `PATH`. Hence, no process is started to find a downloader.
+     *
+     * The cached program is executed, hence the cache must not be writable by other users: It is neither used nor
+     * written if `cache_directory` is the temporary directory, e.g. `/tmp`, and it is ignored unless the cache file
+     * belongs to the effective user and is not writable by the group or others.
+     */
+    static downloader find_downloader(std::filesystem::path const & cache_directory)
+    {
+        std::filesystem::path const cache_file = is_private_directory(cache_directory)
+                                                   ? cache_directory / "downloader"
+                                                   : std::filesystem::path{};
+
+        if (is_private_file(cache_file))
+        {
+            std::ifstream cache{cache_file};
+            std::string cached_name{};
+            std::string cached_path{};
+
+            if (std::getline(cache, cached_name) && std::getline(cache, cached_path) && is_executable(cached_path)
+                && is_in_path(cached_path, cached_name))
+            {
+                for (downloader & known : known_downloaders())
+                {
+                    if (known.name == cached_name)
+                    {
+                        known.path = cached_path;
+                        return known;
+                    }
+                }
+            }
+        }
+
+        for (downloader & known : known_downloaders())
+        {
+            known.path = find_in_path(known.name);
+
+            if (known.path.empty())
+                continue;
+
+            if (!cache_file.empty()
+                && replace_file(cache_file, std::string{known.name} + '\n' + known.path.string() + '\n'))
+            {
+                std::error_code error{};
+                std::filesystem::permissions(cache_file,
+                                             std::filesystem::perms::group_write | std::filesystem::perms::others_write,
+                                             std::filesystem::perm_options::remove,
+                                             error);
+            }
+
+            return known;
+        }
+
+        return {};
     }
+#endif
 
     //!\brief Returns a writable path to store timestamp and version files or an empty path if none exists.
     static std::filesystem::path get_path()
@@ -278,6 +377,12 @@ public:
      * If the user explicitly uses the --version-check option (user_approval is set) it rules out all following
      * decisions. No cookie is written.
      *
+     * If the application runs in a job of a batch scheduler (SLURM, PBS or LSF), no version check is done.
+     *
+     * The cookie is only read by the process that takes the lease of the cookie path (see take_lease()). All other
+     * processes, e.g. of a job array that shares the home directory, do not perform the version check until the
+     * lease expires after a day. These decisions are made by decide_without_cookie() with at most one `stat` call.
+     *
      * If none of the above apply, version check was not explicitly handled so cookie content is checked:
      * * NEVER: Do not perform the version check and do not change the cookie.
      * * ALWAYS: Do perform the version check once a day and do not change the cookie.
@@ -289,15 +394,13 @@ public:
      */
     bool decide_if_check_is_performed(update_notifications developer_approval, std::optional<bool> user_approval)
     {
-        if (developer_approval == update_notifications::off)
-            return false;
+        if (std::optional<bool> const decision = decide_without_cookie(name, developer_approval, user_approval))
+            return *decision;
 
-        if (std::getenv("SHARG_NO_VERSION_CHECK") != nullptr) // environment variable was set
+        // Another process checks the version or has done so less than a day ago.
+        if (!take_lease())
             return false;
 
-        if (user_approval.has_value())
-            return user_approval.value();
-
         // version check was not explicitly handled so let's check the cookie
         if (std::filesystem::exists(cookie_path))
         {
@@ -388,6 +491,97 @@ public:
         }
     } // LCOV_EXCL_STOP
 
+    /*!\brief Returns the decision of decide_if_check_is_performed() if it does not depend on the cookie.
+     * \param[in] app_name           The application name.
+     * \param[in] developer_approval See decide_if_check_is_performed().
+     * \param[in] user_approval      See decide_if_check_is_performed().
+     * \returns The decision, or `std::nullopt` if the cookie must be read.
+     *
+     * \details
+     *
+     * Apart from reading environment variables, this function only calls `stat` on the lease file in the
+     * configuration directory, see take_lease(). It does not construct a version_checker, which accesses the file
+     * system to find a writable directory.
+     */
+    static std::optional<bool> decide_without_cookie(std::string const & app_name,
+                                                     update_notifications developer_approval,
+                                                     std::optional<bool> user_approval)
+    {
+        if (developer_approval == update_notifications::off)
+            return false;
+
+        if (std::getenv("SHARG_NO_VERSION_CHECK") != nullptr) // environment variable was set
+            return false;
+
+        if (user_approval.has_value())
+            return user_approval.value();
+
+        if (runs_in_batch_job())
+            return false;
+
+        if (char const * const home = std::getenv(home_env_name); home != nullptr)
+        {
+            if (lease_is_active(std::filesystem::path{home} / ".config" / "seqan" / (app_name + ".lease")))
+                return false;
+        }
+
+        return std::nullopt;
+    }
+
+    //!\brief Whether the application runs in a job of SLURM, PBS/Torque or LSF.
+    static bool runs_in_batch_job()
+    {
+        for (char const * const variable : {"SLURM_JOB_ID", "PBS_JOBID", "LSB_JOBID"})
+        {
+            if (std::getenv(variable) != nullptr)
+                return true;
+        }
+
+        return false;
+    }
+
+    /*!\brief Takes the lease of the version check for a day, unless another process holds it.
+     * \returns Whether this process took the lease.
+     *
+     * \details
+     *
+     * The lease is the file `{app_name}.lease` in the cookie path, whose modification time is the time at which the
+     * lease expires. While a process holds an exclusive `flock` of `{app_name}.lock`, it checks the lease and,
+     * if it has expired, replaces the lease file via rename (see sharg::detail::replace_file). If the lock is held by
+     * another process, the lease is not taken. Hence, exactly one of many concurrently started processes that share
+     * the cookie path takes the lease, including processes on different hosts if the file system supports `flock`,
+     * e.g. NFS. On Windows, there is no lease, i.e. the lease is always taken.
+     */
+    bool take_lease() const
+    {
+#if defined(_WIN32)
+        return true;
+#else
+        if (cookie_path.empty())
+            return true;
+
+        int const lock_file = ::open((cookie_path / (name + ".lock")).c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+        if (lock_file == -1) // The lock cannot be used, e.g. on a read-only file system.
+            return true;
+
+        bool taken{false};
+
+        if (::flock(lock_file, LOCK_EX | LOCK_NB) == 0)
+        {
+            std::filesystem::path const lease_file = cookie_path / (name + ".lease");
+            auto const expiry = std::filesystem::file_time_type::clock::now() + std::chrono::hours{24};
+
+            // The content is informative only; the expiry is the modification time.
+            if (!lease_is_active(lease_file))
+                taken = replace_file(lease_file, std::to_string(current_timestamp() + 86400) + '\n', expiry);
+        }
+
+        ::close(lock_file); // Releases the lock.
+        return taken;
+#endif
+    }
+
     //!\brief The identification string that may appear in the version file if an app is unregistered.
     static constexpr std::string_view unregistered_app = "UNREGISTERED_APP";
     //!\brief The message directed to the developer of the app if a new sharg version is available.
@@ -428,41 +622,124 @@ public:
     //!\brief The version of the application.
     std::string version{"0.0.0"};
     //!\brief The regex to verify a valid version string.
-    std::regex version_regex{"^[[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+$"};
+    using version_regex = static_regex<"[0-9]+\\.[0-9]+\\.[0-9]+">;
     //!\brief The path to store timestamp and version files (either ~/.config/seqan or the tmp directory).
     std::filesystem::path cookie_path = get_path();
     //!\brief The timestamp filename.
     std::filesystem::path timestamp_filename;
+    //!\brief Provides the version information; see sharg::detail::update_feed::select.
+    update_feed feed{update_feed::select({})};
 
 private:
-    //!\brief Returns the command line call as a std::string of an available program depending on the environment.
-    static std::string get_program()
+    //!\brief Returns the query for the version information of this app and Sharg, see sharg::detail::update_feed.
+    std::string server_query() const
     {
-#if defined(_WIN32)
-        return "powershell.exe -NoLogo -NonInteractive -Command \"& {Invoke-WebRequest -erroraction 'silentlycontinue' "
-               "-OutFile";
-#else // Unix based platforms.
-        if (!system("/usr/bin/env -i wget --version > /dev/null 2>&1"))
-            return "/usr/bin/env -i wget --timeout=10 --tries=1 -q -O";
-        else if (!system("/usr/bin/env -i curl --version > /dev/null 2>&1"))
-            return "/usr/bin/env -i curl --connect-timeout 10 -o";
-// In case neither wget nor curl is available try ftp/fetch if system is OpenBSD/FreeBSD.
-// Note, both systems have ftp/fetch command installed by default so we do not guard against it.
+        return std::string{"SeqAn-Sharg_"} +
+#ifdef __linux
+               "Linux" +
+#elif __APPLE__
+               "MacOS" +
+#elif defined(_WIN32)
+               "Windows" +
+#elif __FreeBSD__
+               "FreeBSD" +
+#elif __OpenBSD__
+               "OpenBSD" +
+#else
+               "unknown" +
+#endif
+#if __x86_64__ || __ppc64__
+               "_64_" +
+#else
+               "_32_" +
+#endif
+               name +          // !user input! escaped on construction of the parser
+               "_" + version; // !user input! escaped on construction of the version_checker
+    }
+
+#if !defined(_WIN32)
+    //!\brief The downloaders in order of preference; their paths are empty.
+    static std::vector<downloader> known_downloaders()
+    {
+        std::vector<downloader> result{{"wget", {"--timeout=10", "--tries=1", "-q", "-O"}},
+                                       {"curl", {"--connect-timeout", "10", "-o"}}};
+// Note, both systems have ftp/fetch command installed by default.
 #    if defined(__OpenBSD__)
-        return "/usr/bin/env -i ftp -w10 -Vo";
+        result.push_back({"ftp", {"-w10", "-Vo"}});
 #    elif defined(__FreeBSD__)
-        return "/usr/bin/env -i fetch --timeout=10 -o";
-#    else
-        return "";
-#    endif // __OpenBSD__
-#endif     // defined(_WIN32)
+        result.push_back({"fetch", {"--timeout=10", "-o"}});
+#    endif
+        return result;
+    }
+
+    //!\brief Whether `path` is a regular file that can be executed.
+    static bool is_executable(std::filesystem::path const & path)
+    {
+        std::error_code error{};
+        return path.is_absolute() && std::filesystem::is_regular_file(path, error) && ::access(path.c_str(), X_OK) == 0;
+    }
+
+    //!\brief Returns the absolute directories in the environment variable `PATH`.
+    static std::vector<std::filesystem::path> path_directories()
+    {
+        char const * const path_variable = std::getenv("PATH");
+        std::string_view directories = path_variable != nullptr ? path_variable : "/bin:/usr/bin";
+        std::vector<std::filesystem::path> result{};
+
+        while (!directories.empty())
+        {
+            size_t const separator = std::min(directories.find(':'), directories.size());
+            std::filesystem::path directory{directories.substr(0, separator)};
+            directories.remove_prefix(std::min(separator + 1u, directories.size()));
+
+            if (directory.is_absolute())
+                result.push_back(std::move(directory));
+        }
+
+        return result;
+    }
+
+    //!\brief Returns the absolute path of the executable `program` in the environment variable `PATH` or an empty path.
+    static std::filesystem::path find_in_path(std::string_view const program)
+    {
+        for (std::filesystem::path const & directory : path_directories())
+        {
+            if (std::filesystem::path candidate = directory / program; is_executable(candidate))
+                return candidate;
+        }
+
+        return {};
+    }
+
+    //!\brief Whether `path` is the program `program` in a directory of the environment variable `PATH`.
+    static bool is_in_path(std::filesystem::path const & path, std::string_view const program)
+    {
+        std::vector<std::filesystem::path> const directories = path_directories();
+        return path.filename() == program && std::ranges::find(directories, path.parent_path()) != directories.end();
+    }
+
+    //!\brief Whether `directory` is not empty and not the temporary directory, which every user can write to.
+    static bool is_private_directory(std::filesystem::path const & directory)
+    {
+        std::error_code error{};
+        return !directory.empty()
+            && !std::filesystem::equivalent(directory, std::filesystem::temp_directory_path(error), error) && !error;
     }
 
+    //!\brief Whether `file` is a regular file of the effective user that the group and others cannot write.
+    static bool is_private_file(std::filesystem::path const & file)
+    {
+        struct stat status
+        {};
+        return !file.empty() && ::lstat(file.c_str(), &status) == 0 && S_ISREG(status.st_mode)
+            && status.st_uid == ::geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+    }
+#endif
+
     //!\brief Reads the timestamp file if possible and returns the time difference to the current time.
     double get_time_diff_to_current(std::string const & str_time) const
     {
-        namespace co = std::chrono;
-        double curr = co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
+        double curr = current_timestamp();
 
         double d_time{};
         std::from_chars(str_time.data(), str_time.data() + str_time.size(), d_time);
@@ -470,6 +747,31 @@ private:
         return curr - d_time;
     }
 
+    //!\brief Returns the current time in seconds since the epoch.
+    static int64_t current_timestamp()
+    {
+        namespace co = std::chrono;
+        return co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
+    }
+
+    //!\brief Whether the modification time of `lease_file` is in the future, see take_lease(); one `stat` call.
+    static bool lease_is_active(std::filesystem::path const & lease_file)
+    {
+        std::error_code error{};
+        auto const expiry = std::filesystem::last_write_time(lease_file, error);
+
+        return !error && expiry > std::filesystem::file_time_type::clock::now();
+    }
+
+    //!\brief Whether `offline_file` was written less than a day ago, see operator().
+    bool is_offline(std::filesystem::path const & offline_file) const
+    {
+        std::ifstream offline_stream{offline_file};
+        std::string line{};
+
+        return std::getline(offline_stream, line) && get_time_diff_to_current(line) < 86400 /*one day in seconds*/;
+    }
+
     /*!\brief Parses a version string into an array of length 3.
      * \param[in] str The version string that must match sharg::detail::version_regex.
      */
@@ -477,7 +779,7 @@ private:
     {
         std::array<int, 3> result{};
 
-        if (!std::regex_match(str, version_regex))
+        if (!version_regex::match(str))
             return result;
 
         auto res = std::from_chars(str.data(), str.data() + str.size(), result[0]); // stops and sets res.ptr at '.'
@@ -495,16 +797,10 @@ private:
     void write_cookie(msg_type && msg)
     {
         // The current time
-        namespace co = std::chrono;
-        auto curr = co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
-
-        std::ofstream timestamp_file{timestamp_filename};
+        std::string content = std::to_string(current_timestamp()) + '\n';
+        content += msg;
 
-        if (timestamp_file.is_open())
-        {
-            timestamp_file << curr << '\n' << msg;
-            timestamp_file.close();
-        }
+        replace_file(timestamp_filename, content);
     }
 };
 
@@ -13,6 +13,7 @@
 #include <string_view>
 #include <unordered_map>
 
+#include <sharg/enumeration_table.hpp>
 #include <sharg/platform.hpp>
 
 namespace sharg::custom
@@ -174,7 +175,8 @@ namespace sharg
 /*!\brief Return a conversion map from std::string_view to option_type.
  * \tparam your_type Type of the value to retrieve the conversion map for.
  * \param value The value is not accessed, only its type is used.
- * \returns A std::unordered_map<std::string_view, your_type> that maps a string identifier to a value of your_type.
+ * \returns A std::unordered_map<std::string_view, your_type> or a sharg::enumeration_table that maps a string
+ *          identifier to a value of your_type.
  * \ingroup misc
  * \details
  *
@@ -183,9 +185,13 @@ namespace sharg
  * It acts as a wrapper and looks for two possible implementations (in this order):
  *
  *   1. A static member `enumeration_names` in `sharg::custom::parsing<your_type>` that is of type
- *      `std::unordered_map<std::string_view, your_type>>`.
+ *      `std::unordered_map<std::string_view, your_type>>` or sharg::enumeration_table.
  *   2. A free function `enumeration_names(your_type const a)` in the namespace of your type (or as `friend`) which
- *      returns a `std::unordered_map<std::string_view, your_type>>`.
+ *      returns a `std::unordered_map<std::string_view, your_type>>` or a sharg::enumeration_table.
+ *
+ * The conversion map is only created once; sharg::enumeration_names<your_type> refers to it.
+ * If the function is `constexpr` (or the static member is `static constexpr`) and returns a
+ * sharg::enumeration_table, the map is created at compile time.
  *
  * ### Example
  *
@@ -223,7 +229,7 @@ inline auto const enumeration_names = detail::adl_only::enumeration_names_cpo<op
  * ### Requirements
  *
  * * An instance of sharg::enumeration_names<option_type> must exist and be of the type
- *   `std::unordered_map<std::string, option_type>`.
+ *   `std::unordered_map<std::string, option_type>` or sharg::enumeration_table.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
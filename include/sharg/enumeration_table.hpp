@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::enumeration_table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Reads `count` characters as a little-endian integer.
+ * \ingroup misc
+ * \tparam word_t The type of the integer; either uint32_t or uint64_t.
+ * \param[in] str Pointer to the first character.
+ * \returns The integer.
+ */
+template <typename word_t>
+constexpr word_t enumeration_load(char const * const str) noexcept
+{
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+    {
+        word_t word;
+        std::memcpy(&word, str, sizeof(word_t));
+        return word;
+    }
+
+    word_t word{};
+    for (size_t k = 0; k < sizeof(word_t); ++k)
+        word |= word_t{static_cast<unsigned char>(str[k])} << (8u * k);
+    return word;
+}
+
+/*!\brief Hashes a string for sharg::enumeration_table.
+ * \ingroup misc
+ * \param[in] str The string to hash.
+ * \returns The hash value.
+ *
+ * \details
+ *
+ * The string is read in (possibly overlapping) words of eight characters, i.e. names of up to eight characters cost
+ * a single multiplication. The length is part of the hash, hence overlapping words do not cause collisions.
+ */
+constexpr uint64_t enumeration_hash(std::string_view const str) noexcept
+{
+    size_t const size = str.size();
+    char const * const data = str.data();
+    uint64_t hash = 0xcbf29ce484222325ULL ^ size;
+
+    auto mix = [&hash](uint64_t const word)
+    {
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 32;
+    };
+
+    if (size >= 8u)
+    {
+        for (size_t i = 0; i + 8u < size; i += 8u)
+            mix(enumeration_load<uint64_t>(data + i));
+        mix(enumeration_load<uint64_t>(data + size - 8u));
+    }
+    else if (size >= 4u)
+    {
+        mix(enumeration_load<uint32_t>(data) | uint64_t{enumeration_load<uint32_t>(data + size - 4u)} << 32);
+    }
+    else if (size > 0u)
+    {
+        mix(uint64_t{static_cast<unsigned char>(data[0])} | uint64_t{static_cast<unsigned char>(data[size / 2u])} << 8
+            | uint64_t{static_cast<unsigned char>(data[size - 1u])} << 16);
+    }
+    else
+    {
+        mix(0u);
+    }
+
+    return hash;
+}
+
+/*!\brief Returns the `bits` most significant bits of `value`.
+ * \ingroup misc
+ * \param[in] value The value.
+ * \param[in] bits The number of bits to keep, may be 0.
+ * \returns The `bits` most significant bits of `value`.
+ */
+constexpr size_t enumeration_high_bits(uint64_t const value, size_t const bits) noexcept
+{
+    return bits == 0u ? 0u : static_cast<size_t>(value >> (64u - bits));
+}
+
+/*!\brief Finaliser of MurmurHash3, used to derive the multipliers of sharg::enumeration_table.
+ * \ingroup misc
+ * \param[in] value The value to mix.
+ * \returns The mixed value.
+ */
+constexpr uint64_t enumeration_mix(uint64_t value) noexcept
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+
+    return value;
+}
+
+} // namespace sharg::detail
+
+namespace sharg
+{
+
+/*!\brief A constant lookup table from names to values of an enumeration with a compile-time perfect hash.
+ * \ingroup misc
+ * \tparam option_t The type of the values.
+ * \tparam entry_count The number of name/value pairs.
+ *
+ * \details
+ *
+ * This table can be returned by the customisation point sharg::enumeration_names instead of a
+ * `std::unordered_map<std::string_view, option_t>`. If it is built in a constant expression (e.g. by a `constexpr`
+ * `enumeration_names` function or a `static constexpr` member of sharg::custom::parsing), the hash function is chosen
+ * at compile time and sharg::enumeration_names<option_t> does not need any construction at runtime.
+ *
+ * The hash is a two-level perfect hash ("hash and displace"): every name is first assigned to a bucket; for each
+ * bucket, a multiplier is searched such that all names in the bucket are hashed to empty slots. Looking up a name
+ * hence hashes the name once, performs two multiplications and at most one string comparison. Tables with fewer than
+ * four names are searched linearly instead.
+ *
+ * Like a `std::unordered_map`, the table is a range of `std::pair<std::string_view, option_t>` and provides
+ * a `find` member function. The elements are stored in the order in which they were given.
+ *
+ * \include test/snippet/custom_enumeration_table.cpp
+ *
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename option_t, size_t entry_count>
+    requires (entry_count > 0u)
+class enumeration_table
+{
+public:
+    //!\brief The type of the elements.
+    using value_type = std::pair<std::string_view, option_t>;
+    //!\brief The type of the iterators.
+    using const_iterator = value_type const *;
+    //!\brief The type of the iterators.
+    using iterator = const_iterator;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr enumeration_table() = delete;                                       //!< Deleted.
+    constexpr enumeration_table(enumeration_table const &) = default;             //!< Defaulted.
+    constexpr enumeration_table & operator=(enumeration_table const &) = default; //!< Defaulted.
+    constexpr enumeration_table(enumeration_table &&) = default;                  //!< Defaulted.
+    constexpr enumeration_table & operator=(enumeration_table &&) = default;      //!< Defaulted.
+    ~enumeration_table() = default;                                               //!< Defaulted.
+
+    /*!\brief Constructs the table from name/value pairs and computes the perfect hash.
+     * \param[in] pairs The name/value pairs.
+     * \throws sharg::design_error if a name occurs more than once. In a constant expression, this results in a
+     *         compile-time error.
+     */
+    constexpr enumeration_table(value_type const (&pairs)[entry_count]) :
+        entries{std::to_array(pairs)},
+        multipliers{},
+        slots{}
+    {
+        build();
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first name/value pair.
+    constexpr const_iterator begin() const noexcept
+    {
+        return entries.data();
+    }
+
+    //!\brief Returns an iterator behind the last name/value pair.
+    constexpr const_iterator end() const noexcept
+    {
+        return entries.data() + entry_count;
+    }
+    //!\}
+
+    //!\brief Returns the number of name/value pairs.
+    static constexpr size_t size() noexcept
+    {
+        return entry_count;
+    }
+
+    /*!\brief Looks up a name.
+     * \param[in] name The name to look up.
+     * \returns An iterator to the name/value pair with the given name or end() if there is no such name.
+     */
+    constexpr const_iterator find(std::string_view const name) const noexcept
+    {
+        if constexpr (entry_count < linear_search_threshold)
+        {
+            return std::ranges::find(entries, name, &value_type::first);
+        }
+        else
+        {
+            uint64_t const hash = detail::enumeration_hash(name);
+            uint64_t const multiplier = multipliers[bucket_of(hash)];
+            size_t const index = slots[detail::enumeration_high_bits(hash * multiplier, slot_bits)];
+
+            return (index != empty_slot && entries[index].first == name) ? begin() + index : end();
+        }
+    }
+
+private:
+    //!\brief Smaller tables are searched linearly, which is faster than computing the hash.
+    static constexpr size_t linear_search_threshold = 4u;
+    //!\brief The number of first-level buckets.
+    static constexpr size_t bucket_count = std::bit_ceil(entry_count);
+    //!\brief The number of bits needed to address a bucket.
+    static constexpr size_t bucket_bits = std::countr_zero(bucket_count);
+    //!\brief The number of slots. Twice the number of entries keeps the search for multipliers short.
+    static constexpr size_t slot_count = 2u * bucket_count;
+    //!\brief The number of bits needed to address a slot.
+    static constexpr size_t slot_bits = bucket_bits + 1u;
+    //!\brief Marks an unused slot.
+    static constexpr size_t empty_slot = std::numeric_limits<size_t>::max();
+
+    //!\brief The name/value pairs in the given order.
+    std::array<value_type, entry_count> entries;
+    //!\brief The (odd) multiplier of the second-level hash for each bucket.
+    std::array<uint64_t, bucket_count> multipliers;
+    //!\brief The index into `entries` for each slot, or `empty_slot`.
+    std::array<size_t, slot_count> slots;
+
+    //!\brief Returns the first-level bucket of a hash value.
+    static constexpr size_t bucket_of(uint64_t const hash) noexcept
+    {
+        return detail::enumeration_high_bits(hash * 0xff51afd7ed558ccdULL, bucket_bits);
+    }
+
+    //!\brief Assigns each name a unique slot.
+    constexpr void build()
+    {
+        slots.fill(empty_slot);
+
+        // Distribute the entries into buckets.
+        std::array<uint64_t, entry_count> hashes{};
+        std::array<size_t, entry_count> entry_bucket{};
+        std::array<size_t, bucket_count> bucket_size{};
+
+        for (size_t i = 0; i < entry_count; ++i)
+        {
+            hashes[i] = detail::enumeration_hash(entries[i].first);
+            entry_bucket[i] = bucket_of(hashes[i]);
+            ++bucket_size[entry_bucket[i]];
+
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (entries[j].first == entries[i].first)
+                    throw design_error{"The name " + std::string{entries[i].first}
+                                       + " occurs more than once in the enumeration table."};
+
+                // No multiplier can separate two names with the same hash value.
+                if (hashes[j] == hashes[i])
+                    throw design_error{"The names " + std::string{entries[j].first} + " and "
+                                       + std::string{entries[i].first} + " have the same hash value."};
+            }
+        }
+
+        // Place the largest buckets first, they are the hardest to place.
+        std::array<size_t, bucket_count> bucket_order{};
+        for (size_t b = 0; b < bucket_count; ++b)
+            bucket_order[b] = b;
+
+        std::ranges::sort(bucket_order,
+                          [&bucket_size](size_t const lhs, size_t const rhs)
+                          {
+                              return bucket_size[lhs] > bucket_size[rhs]
+                                  || (bucket_size[lhs] == bucket_size[rhs] && lhs < rhs);
+                          });
+
+        std::array<size_t, slot_count> bucket_slots{};
+
+        for (size_t const bucket : bucket_order)
+        {
+            if (bucket_size[bucket] == 0u)
+                break;
+
+            for (uint64_t seed = 1u;; ++seed)
+            {
+                uint64_t const multiplier = detail::enumeration_mix(seed) | 1u;
+                size_t placed{};
+                bool success{true};
+
+                for (size_t i = 0; success && i < entry_count; ++i)
+                {
+                    if (entry_bucket[i] != bucket)
+                        continue;
+
+                    size_t const slot = detail::enumeration_high_bits(hashes[i] * multiplier, slot_bits);
+
+                    // The slot must be free and not be used by another entry of this bucket.
+                    success = slots[slot] == empty_slot
+                           && std::ranges::find(bucket_slots.begin(), bucket_slots.begin() + placed, slot)
+                                  == bucket_slots.begin() + placed;
+                    bucket_slots[placed++] = slot;
+                }
+
+                if (!success)
+                    continue;
+
+                multipliers[bucket] = multiplier;
+
+                for (size_t i = 0, k = 0; i < entry_count; ++i)
+                    if (entry_bucket[i] == bucket)
+                        slots[bucket_slots[k++]] = i;
+
+                break;
+            }
+        }
+    }
+};
+
+} // namespace sharg
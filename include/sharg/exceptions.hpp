@@ -189,6 +189,30 @@ public:
     {}
 };
 
+/*!\brief Parser exception thrown when validating an argument did not finish in time.
+ * \ingroup exceptions
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \details
+ *
+ * Thrown if the file system did not respond within the timeout set by sharg::parser::set_validation_timeout,
+ * e.g. because a network mount is unavailable. The message names the path that was checked.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+class validation_timeout : public validation_error
+{
+public:
+    /*!\brief The constructor.
+     * \param[in] s The error message.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    validation_timeout(std::string const & s) : validation_error(s)
+    {}
+};
+
 /*!\brief Parser exception that is thrown whenever there is an design
  * error directed at the developer of the application (e.g. Reuse of option).
  *
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides the sharg::from_string customisation point.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <string_view>
+
+#include <sharg/enumeration_names.hpp>
+
+namespace sharg::detail::adl_only
+{
+
+//!\brief Poison-pill overload to prevent non-ADL forms of unqualified lookup.
+template <typename t>
+t from_string(t, std::string_view) = delete;
+
+//!\brief Customization Point Object (CPO) definition for sharg::from_string.
+//!\ingroup misc
+//!\remark For a complete overview, take a look at \ref parser
+template <typename option_t>
+struct from_string_cpo
+{
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr from_string_cpo() = default;                                    //!< Defaulted.
+    constexpr from_string_cpo(from_string_cpo &&) = default;                  //!< Defaulted.
+    constexpr from_string_cpo(from_string_cpo const &) = default;             //!< Defaulted.
+    constexpr from_string_cpo & operator=(from_string_cpo &&) = default;      //!< Defaulted.
+    constexpr from_string_cpo & operator=(from_string_cpo const &) = default; //!< Defaulted.
+    //!\}
+
+    /*!\brief If `option_t` is not std::is_nothrow_default_constructible, from_string will be called with
+     *        std::type_identity instead of a default constructed value.
+     */
+    template <typename option_type>
+    using option_or_type_identity =
+        std::conditional_t<std::is_nothrow_default_constructible_v<std::remove_cvref_t<option_type>>,
+                           std::remove_cvref_t<option_type>,
+                           std::type_identity<option_type>>;
+
+    /*!\brief CPO overload (check 1 out of 2): explicit customisation via `sharg::custom::parsing`
+     * \tparam option_type The type of the option. (Needed to defer instantiation for incomplete types.)
+     */
+    template <typename option_type = option_t>
+    static constexpr auto cpo_overload(sharg::detail::priority_tag<1>, std::string_view const str) noexcept(
+        noexcept(sharg::custom::parsing<option_type>::from_string(str)))
+        -> decltype(sharg::custom::parsing<option_type>::from_string(str))
+    {
+        return sharg::custom::parsing<option_type>::from_string(str);
+    }
+
+    /*!\brief CPO overload (check 2 out of 2): argument dependent lookup (ADL), i.e.
+     *        `from_string(option_type{}, str)`
+     * \tparam option_type The type of the option. (Needed to defer instantiation for incomplete types.)
+     *
+     * \details
+     *
+     * If the option_type is not std::is_nothrow_default_constructible,
+     * `from_string(std::type_identity<option_t>{}, str)` will be called.
+     */
+    template <typename option_type = option_t>
+    static constexpr auto cpo_overload(sharg::detail::priority_tag<0>, std::string_view const str) noexcept(
+        noexcept(from_string(option_or_type_identity<option_type>{}, str)))
+        -> decltype(from_string(option_or_type_identity<option_type>{}, str))
+    {
+        return from_string(option_or_type_identity<option_type>{}, str);
+    }
+
+    /*!\brief SFINAE-friendly call-operator to resolve the CPO overload.
+     *
+     * This operator decides which `cpo_overload` implementation to use. It will start with the highest
+     * priority, in this case `sharg::detail::priority_tag<1>`. If this is not well-defined, the base class
+     * of the priority_tag is checked (`sharg::detail::priority_tag<0>`).
+     *
+     * If any matching overload is found, this operator perfectly forwards the result and noexcept-property of the
+     * `cpo_overload`.
+     */
+    template <typename option_type = option_t /*circumvent incomplete types*/>
+    constexpr auto operator()(std::string_view const str) const
+        noexcept(noexcept(cpo_overload<option_type>(sharg::detail::priority_tag<1>{}, str)))
+            -> decltype(cpo_overload<option_type>(sharg::detail::priority_tag<1>{}, str))
+    {
+        return cpo_overload<option_type>(sharg::detail::priority_tag<1>{}, str);
+    }
+};
+
+} // namespace sharg::detail::adl_only
+
+namespace sharg
+{
+
+/*!\name Customisation Points
+ * \{
+ */
+
+/*!\brief Converts a command line argument into a value of option_type without using `operator>>`.
+ * \tparam your_type Type of the value to convert the argument into.
+ * \param str The command line argument.
+ * \returns A value of your_type.
+ * \ingroup misc
+ * \details
+ *
+ * This is a function object. Invoke it with the parameter(s) specified above.
+ *
+ * It acts as a wrapper and looks for two possible implementations (in this order):
+ *
+ *   1. A static member function `from_string(std::string_view)` in `sharg::custom::parsing<your_type>` that returns
+ *      a `your_type`.
+ *   2. A free function `from_string(your_type const a, std::string_view str)` in the namespace of your type (or as
+ *      `friend`) which returns a `your_type`.
+ *
+ * If available, the sharg::parser uses this customisation point instead of the stream operator (`operator>>`)
+ * to parse option values, which avoids constructing a stream for every value.
+ *
+ * In order to signal that `str` is not a valid value, throw an exception. A sharg::parser_error is forwarded to
+ * the user as is, any other exception results in the message that the argument could not be parsed.
+ *
+ * ### Example
+ *
+ * If you are working on a type in your namespace, you should implement a free function like this:
+ *
+ * \include test/snippet/custom_from_string.cpp
+ *
+ * **Only if you cannot access the namespace of your type to customize** you may specialize
+ * the sharg::custom::parsing struct like this:
+ *
+ * \include test/snippet/custom_parsing_from_string.cpp
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * ### Customisation point
+ *
+ * This is a customisation point (see \ref about_customisation). To specify the behaviour for your type,
+ * simply provide one of the two functions specified above.
+ *
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename option_type>
+inline constexpr detail::adl_only::from_string_cpo<option_type> from_string{};
+//!\}
+
+/*!\concept sharg::from_string_parsable
+ * \brief Checks whether the customisation point sharg::from_string can be called for the type.
+ * \ingroup misc
+ * \tparam option_type The type to check.
+ *
+ * ### Requirements
+ *
+ * * `sharg::from_string<option_type>(str)` must be callable with a `std::string_view` and return a type that is
+ *   convertible to `option_type`.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+// clang-format off
+template <typename option_type>
+concept from_string_parsable = requires (std::string_view const str)
+{
+    { sharg::from_string<option_type>(str) } -> std::convertible_to<option_type>;
+};
+// clang-format on
+
+} // namespace sharg
@@ -9,15 +9,21 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <span>
 #include <unordered_set>
 #include <variant>
 
 #include <sharg/config.hpp>
+#include <sharg/detail/deadline.hpp>
 #include <sharg/detail/format_help.hpp>
 #include <sharg/detail/format_html.hpp>
 #include <sharg/detail/format_man.hpp>
 #include <sharg/detail/format_parse.hpp>
 #include <sharg/detail/format_tdl.hpp>
+#include <sharg/detail/regex.hpp>
+#include <sharg/detail/response_file.hpp>
 #include <sharg/detail/version_check.hpp>
 
 namespace sharg
@@ -179,31 +185,52 @@ public:
      * \stableapi{Since version 1.0.}
      */
     parser(std::string const & app_name,
-           std::vector<std::string> const & arguments,
+           std::vector<std::string> arguments,
            update_notifications version_updates = update_notifications::on,
            std::vector<std::string> subcommands = {}) :
         version_check_dev_decision{version_updates},
-        arguments{arguments}
+        owned_arguments{std::move(arguments)}
     {
+        this->arguments.assign(owned_arguments.begin(), owned_arguments.end());
         add_subcommands(subcommands);
         info.app_name = app_name;
     }
 
-    //!\overload
+    /*!\overload
+     * \details
+     * The arguments are not copied. The parser only stores views into `argv`, which must outlive the parser.
+     */
     parser(std::string const & app_name,
            int const argc,
            char const * const * const argv,
            update_notifications version_updates = update_notifications::on,
            std::vector<std::string> subcommands = {}) :
-        parser{app_name, std::vector<std::string>{argv, argv + argc}, version_updates, std::move(subcommands)}
-    {}
+        version_check_dev_decision{version_updates},
+        arguments{argv, argv + argc}
+    {
+        add_subcommands(subcommands);
+        info.app_name = app_name;
+    }
 
-    //!\brief The destructor.
+    /*!\brief The destructor.
+     * \details
+     * Waits for the version check at most for the budget set via sharg::parser::set_version_check_exit_budget
+     * (default: 0) and cancels it afterwards.
+     *
+     * With asynchronous validation, see sharg::parser::enable_async_validation, the destructor waits for the
+     * validations. If a value is not valid and sharg::parser::wait_validated was not called, the error is printed to
+     * std::cerr and the program exits with `EXIT_FAILURE`, because the application ran with an invalid value. If an
+     * exception is propagating, the error is only printed.
+     */
     ~parser()
     {
-        // wait for another 3 seconds
-        if (version_check_future.valid())
-            version_check_future.wait_for(std::chrono::seconds(3));
+        report_unobserved_validation_error();
+
+        if (version_check_future.valid()
+            && version_check_future.wait_for(version_check_exit_budget) == std::future_status::timeout)
+        {
+            version_check_cancellation->cancel();
+        }
     }
     //!\}
 
@@ -231,6 +258,7 @@ public:
      * \throws sharg::design_error if the option is required and has a default_message.
      * \throws sharg::design_error if the option identifier was already used.
      * \throws sharg::design_error if the option identifier is not a valid identifier.
+     * \throws sharg::design_error if a list separator is set but `option_type` is not a container.
      *
      * \details
      * \stableapi{Since version 1.0.}
@@ -243,6 +271,11 @@ public:
         check_parse_not_called("add_option");
         verify_option_config(config);
 
+        if (config.list_separator != '\0' && !detail::is_container_option<option_type>)
+            throw design_error{"A list separator can only be set for options whose value is a list/container."};
+
+        store_default_value(value);
+
         auto operation = [this, &value, config]()
         {
             auto visit_fn = [&value, &config](auto & f)
@@ -263,6 +296,7 @@ public:
      *
      * \throws sharg::design_error if sharg::parser::parse was already called.
      * \throws sharg::design_error if `value` is true.
+     * \throws sharg::design_error if a list separator is set.
      * \throws sharg::design_error if the option identifier was already used.
      * \throws sharg::design_error if the option identifier is not a valid identifier.
      *
@@ -279,6 +313,8 @@ public:
         if (value)
             throw design_error("A flag's default value must be false.");
 
+        store_default_value(value);
+
         auto operation = [this, &value, config]()
         {
             auto visit_fn = [&value, &config](auto & f)
@@ -312,6 +348,7 @@ public:
      * \throws sharg::design_error if the option has a default_message.
      * \throws sharg::design_error if there already is a positional list option.
      * \throws sharg::design_error if there are subcommands.
+     * \throws sharg::design_error if a list separator is set.
      *
      * \details
      *
@@ -330,6 +367,8 @@ public:
         if constexpr (detail::is_container_option<option_type>)
             has_positional_list_option = true; // keep track of a list option because there must be only one!
 
+        store_default_value(value);
+
         auto operation = [this, &value, config]()
         {
             auto visit_fn = [&value, &config](auto & f)
@@ -422,7 +461,7 @@ public:
         verify_app_and_subcommand_names();
 
         // Determine the format and subcommand.
-        determine_format_and_subcommand();
+        determine_format_and_subcommand(arguments);
 
         // Apply all defered operations to the parser, e.g., `add_option`, `add_flag`, `add_positional_option`.
         for (auto & operation : operations)
@@ -432,13 +471,131 @@ public:
         run_version_check();
 
         // Parse the command line arguments.
-        parse_format();
+        parse_format(std::cout);
 
         // Exit after parsing any special format.
         if (!std::holds_alternative<detail::format_parse>(format))
             std::exit(EXIT_SUCCESS);
     }
 
+    /*!\brief Parses the given command line arguments. Can be called any number of times.
+     * \param[in] arguments The command line arguments to parse, starting with the name of the executable.
+     * \param[in] stream The stream that the help page, version and copyright information are printed to.
+     * \returns Which format was processed, e.g. sharg::parse_outcome::help_printed for `--help`.
+     *
+     * \throws sharg::design_error if `arguments` is empty.
+     * \throws sharg::design_error if the application name or subcommands contain illegal characters.
+     * \throws sharg::option_declared_multiple_times if an option that is not a list was declared multiple times.
+     * \throws sharg::user_input_error if an incorrect argument is given as (positional) option value.
+     * \throws sharg::required_option_missing if the user did not provide a required option.
+     * \throws sharg::too_many_arguments if the command line call contained more arguments than expected.
+     * \throws sharg::too_few_arguments if the command line call contained less arguments than expected.
+     * \throws sharg::validation_error if the argument was not excepted by the provided validator.
+     *
+     * \details
+     *
+     * This overload ignores the arguments given on construction and never calls std::exit. Instead, it returns
+     * which of the special formats (see sharg::parser::parse()) was processed, such that a single parser can be used
+     * to parse many command lines, e.g. in a long-running process.
+     * Options, flags and the help page are added once; each call only parses `arguments`.
+     *
+     * Each call after the first one calls sharg::parser::reset() first, i.e. option values that are not set by
+     * `arguments` have the value they had when they were added, and the sub-parser of the previous call is replaced.
+     * The version check is only performed once.
+     *
+     * The strings in `arguments` must outlive the use of sharg::parser::is_option_set and sharg::parser::get_sub_parser.
+     * A sub-parser is parsed without calling std::exit via sharg::parser::parse(std::ostream &).
+     *
+     * ### Example
+     *
+     * \include test/snippet/parser_reuse.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    parse_outcome parse(std::span<std::string_view const> const arguments, std::ostream & stream = std::cout)
+    {
+        return parse_without_exit({arguments.begin(), arguments.end()}, stream);
+    }
+
+    /*!\brief Parses the command line arguments given on construction without calling std::exit.
+     * \param[in] stream The stream that the help page, version and copyright information are printed to.
+     * \returns Which format was processed, e.g. sharg::parse_outcome::help_printed for `--help`.
+     *
+     * \throws sharg::design_error if no arguments were given on construction.
+     * \throws sharg::design_error if the application name or subcommands contain illegal characters.
+     * \throws sharg::option_declared_multiple_times if an option that is not a list was declared multiple times.
+     * \throws sharg::user_input_error if an incorrect argument is given as (positional) option value.
+     * \throws sharg::required_option_missing if the user did not provide a required option.
+     * \throws sharg::too_many_arguments if the command line call contained more arguments than expected.
+     * \throws sharg::too_few_arguments if the command line call contained less arguments than expected.
+     * \throws sharg::validation_error if the argument was not excepted by the provided validator.
+     *
+     * \details
+     *
+     * Behaves like sharg::parser::parse(std::span<std::string_view const>, std::ostream &) for the arguments given
+     * on construction. In particular, this is how the sub-parser of a parser that was parsed without calling
+     * std::exit is parsed, e.g. `app build --help` returns sharg::parse_outcome::help_printed.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    parse_outcome parse(std::ostream & stream)
+    {
+        return parse_without_exit(arguments, stream);
+    }
+
+    /*!\brief Resets the parser to the state before parsing, keeping all added options, flags and help page entries.
+     *
+     * \details
+     *
+     * All option values are set to the values they had when they were added. This only applies to values of
+     * copyable types. The sub-parser and the result of the last call to sharg::parser::parse are discarded.
+     * Afterwards, options can be added and sharg::parser::parse can be called again.
+     *
+     * With asynchronous validation, if a value of the last call to sharg::parser::parse is not valid and
+     * sharg::parser::wait_validated did not throw the error yet, the error is thrown after the parser was reset.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void reset()
+    {
+        // Waits for asynchronous validations, which access the values.
+        std::exception_ptr const validation_error = unobserved_validation_error();
+        format = detail::format_short_help{};
+
+        for (auto & reset_operation : reset_operations)
+            reset_operation();
+
+        parse_was_called = false;
+        version_check_user_decision.reset();
+        format_arguments.clear();
+        executable_name.resize(parent_executable_name_size);
+        sub_parser.reset();
+        response_files = {};
+
+        if (validation_error != nullptr)
+            std::rethrow_exception(validation_error);
+    }
+
+    /*!\brief Waits until the values are validated if sharg::parser::enable_async_validation was called.
+     * \throws sharg::design_error if sharg::parser::parse was not called.
+     * \throws sharg::validation_error if a value was not accepted by its validator.
+     * \details
+     *
+     * If several values are not valid, the error of the first one in parsing order is thrown. Without asynchronous
+     * validation, the values were already validated by sharg::parser::parse and this function returns immediately.
+     * The validation of the sub-parser is awaited by calling this function on the sub-parser.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void wait_validated()
+    {
+        if (!parse_was_called)
+            throw design_error{"The function wait_validated() must be called after parse()!"};
+
+        if (detail::format_parse const * const parse_format = std::get_if<detail::format_parse>(&format))
+            parse_format->wait_validated();
+    }
+
     /*!\brief Returns a reference to the sub-parser instance if
      *       \link subcommand_parse subcommand parsing \endlink was enabled.
      *
@@ -658,6 +815,134 @@ public:
         auto const [first, last] = std::ranges::unique(parser_subcommands);
         parser_subcommands.erase(first, last);
     }
+
+    /*!\brief Expands response files (`@file`) on the command line.
+     * \param[in] syntax The quoting syntax of the response files (default sharg::response_file_syntax::gnu).
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \details
+     *
+     * Each argument `@file` is replaced by the whitespace separated arguments read from `file`, which may contain
+     * further response files. This allows passing more arguments than the operating system permits (`ARG_MAX`).
+     * Relative paths are resolved against the working directory. If the file does not exist, the argument is kept
+     * as is. Arguments after `--` are never expanded. The expansion includes the arguments of subcommands.
+     *
+     * The files are mapped into memory and the arguments are not copied, unless they contain quotes or escapes.
+     *
+     * ### Example
+     *
+     * \include test/snippet/response_files.cpp
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void enable_response_files(response_file_syntax const syntax = response_file_syntax::gnu)
+    {
+        check_parse_not_called("enable_response_files");
+        response_syntax = syntax;
+    }
+
+    /*!\brief Bounds the time that validating a single path may take.
+     * \param[in] timeout The timeout; zero disables it (default).
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \details
+     *
+     * If a validator accesses the file system, e.g. sharg::input_file_validator, and the file system does not respond
+     * within `timeout`, e.g. because a network mount hangs, sharg::parser::parse throws a sharg::validation_timeout
+     * naming the path instead of blocking indefinitely. The system calls are made on a worker thread, which is
+     * abandoned if it does not respond in time. Hence, the timeout adds the cost of a thread handover to each
+     * system call. The timeout also applies to subcommands.
+     *
+     * ```cpp
+     * parser.set_validation_timeout(std::chrono::seconds{5});
+     * ```
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void set_validation_timeout(std::chrono::milliseconds const timeout)
+    {
+        check_parse_not_called("set_validation_timeout");
+        validation_deadline = timeout;
+    }
+
+    /*!\brief Validates the option values on background threads after sharg::parser::parse returned.
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \details
+     *
+     * By default, sharg::parser::parse validates each value right after parsing it. With asynchronous validation,
+     * sharg::parser::parse returns after parsing and converting the values, and the validators run concurrently in
+     * the background. This overlaps expensive validations, e.g. of many files on a network file system, with the
+     * start-up of the application, e.g. loading an index.
+     *
+     * Before using the values, the application must call sharg::parser::wait_validated, which throws the
+     * sharg::validation_error of the first invalid value in parsing order, i.e. the same error that
+     * sharg::parser::parse would have thrown. The validators check copies of the values, hence the values may be
+     * modified or destroyed in the meantime. Values of types that cannot be copied are validated by
+     * sharg::parser::parse. Errors that are not validation errors, e.g. sharg::too_many_arguments, are still thrown by
+     * sharg::parser::parse, even if a preceding value is invalid. Asynchronous validation also applies to
+     * subcommands. Errors are never lost: if sharg::parser::wait_validated was not called, sharg::parser::reset
+     * throws the error, and the destructor prints it and exits with `EXIT_FAILURE`.
+     *
+     * ```cpp
+     * parser.enable_async_validation();
+     * parser.parse();
+     * auto index = load_index(); // The values are validated in the meantime.
+     * parser.wait_validated();
+     * ```
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void enable_async_validation()
+    {
+        check_parse_not_called("enable_async_validation");
+        async_validation = true;
+    }
+
+    /*!\brief Sets the time that the destructor waits for the version check to finish.
+     * \param[in] budget The time; zero by default.
+     * \details
+     *
+     * The version check runs in the background while the application runs. If it has not finished when the parser is
+     * destroyed, the destructor waits at most `budget` and then cancels it, i.e. the downloader is killed. Hence, a
+     * short-running application does not wait for the server on a host without network access. The budget also
+     * applies to subcommands if it is set before sharg::parser::parse is called.
+     *
+     * ```cpp
+     * parser.set_version_check_exit_budget(std::chrono::milliseconds{200});
+     * ```
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void set_version_check_exit_budget(std::chrono::milliseconds const budget)
+    {
+        version_check_exit_budget = budget;
+    }
+
+    /*!\brief Sets the feed that provides the version information for the version check.
+     * \param[in] url The URL of the feed; see below.
+     * \throws sharg::design_error if sharg::parser::parse was already called or the URL is not supported.
+     * \details
+     *
+     * The query of the version check, e.g. `SeqAn-Sharg_Linux_64_app_1.0.0`, is appended to the URL:
+     *
+     * * `https://` or `http://`: A mirror of the SeqAn update server, e.g. `https://mirror.example.org/check/`.
+     *   Only alphanumeric characters and `:/._~%+-` are allowed.
+     * * `file://`: A directory containing one file per query, e.g. `file:///srv/sharg/`.
+     * * `unix://`: A unix domain socket on which an HTTP server answers `GET /{query}`, e.g. `unix:///run/sharg.sock`.
+     *   Not available on Windows.
+     *
+     * The environment variable `SHARG_UPDATE_FEED` overrides the feed, e.g. to use a mirror for all applications on
+     * a cluster. The default is the SeqAn update server. The feed also applies to subcommands.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void set_update_feed(std::string url)
+    {
+        check_parse_not_called("set_update_feed");
+
+        if (!detail::update_feed{url}.is_valid())
+            throw design_error{"The update feed \"" + url + "\" is not supported."};
+
+        update_feed_url = std::move(url);
+    }
     //!\}
 
     /*!\brief Aggregates all parser related meta data (see sharg::parser_meta_data struct).
@@ -731,8 +1016,18 @@ private:
     //!\brief The future object that keeps track of the detached version check call thread.
     std::future<bool> version_check_future;
 
+    //!\brief Stops the version check on destruction if it does not finish within the budget.
+    std::shared_ptr<detail::version_check_cancellation> version_check_cancellation{
+        std::make_shared<detail::version_check_cancellation>()};
+
+    //!\brief The time that the destructor waits for the version check, see set_version_check_exit_budget.
+    std::chrono::milliseconds version_check_exit_budget{};
+
+    //!\brief The URL of the update feed, see set_update_feed; empty for the default feed.
+    std::string update_feed_url{};
+
     //!\brief Validates the application name to ensure an escaped server call.
-    std::regex app_name_regex{"^[a-zA-Z0-9_-]+$"};
+    using app_name_regex = detail::static_regex<"^[a-zA-Z0-9_-]+$">;
 
     //!\brief Signals the parser that no options follow this string but only positional arguments.
     static constexpr std::string_view const option_end_identifier{"--"};
@@ -764,28 +1059,70 @@ private:
     std::unordered_set<std::string> used_ids{"h", "hh", "help", "advanced-help", "export-help", "version", "copyright"};
 
     //!\brief The command line arguments that will be passed to the format.
-    std::vector<std::string> format_arguments{};
+    std::vector<std::string_view> format_arguments{};
+
+    //!\brief Owns the command line arguments if they were not given as `argv` (empty otherwise).
+    std::vector<std::string> owned_arguments{};
 
-    //!\brief The original command line arguments.
-    std::vector<std::string> arguments{};
+    /*!\brief The original command line arguments.
+     * \details
+     * Views into either `argv`, sharg::parser::owned_arguments, sharg::parser::response_files or the arguments of the
+     * parent parser.
+     */
+    std::vector<std::string_view> arguments{};
 
     //!\brief The command that lead to calling this parser, e.g. [./build/bin/raptor, build]
     std::vector<std::string> executable_name{};
 
+    //!\brief Transparent hash that allows looking up a std::string_view in a set of std::string.
+    struct string_hash
+    {
+        using is_transparent = void; //!< Enables heterogeneous lookup.
+
+        //!\brief Returns the hash of `str`.
+        size_t operator()(std::string_view const str) const noexcept
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
     //!\brief Set of option identifiers (including -/--) that have been added via `add_option`.
-    std::unordered_set<std::string> options{};
+    std::unordered_set<std::string, string_hash, std::equal_to<>> options{};
 
     //!\brief Vector of functions that stores all calls.
     std::vector<std::function<void()>> operations;
 
+    //!\brief Vector of functions that restore the values of all options and flags, see sharg::parser::reset.
+    std::vector<std::function<void()>> reset_operations;
+
+    //!\brief The number of elements of sharg::parser::executable_name inherited from the parent parser.
+    size_t parent_executable_name_size{};
+
+    //!\brief Whether the version check was already run.
+    bool version_check_was_run{false};
+
+    //!\brief The quoting syntax of response files; response files are not expanded by default.
+    response_file_syntax response_syntax{response_file_syntax::none};
+
+    //!\brief The timeout of validating a path, see sharg::parser::set_validation_timeout; zero if there is none.
+    std::chrono::milliseconds validation_deadline{};
+
+    //!\brief Whether the values are validated asynchronously, see sharg::parser::enable_async_validation.
+    bool async_validation{false};
+
+    //!\brief Owns the response files that sharg::parser::arguments may refer to.
+    detail::response_file_expander response_files{};
+
     /*!\brief Handles format and subcommand detection.
      * \throws sharg::too_few_arguments if option --export-help was specified without a value
      * \throws sharg::too_few_arguments if option --version-check was specified without a value
      * \throws sharg::validation_error if the value passed to option --export-help was invalid.
      * \throws sharg::validation_error if the value passed to option --version-check was invalid.
      * \throws sharg::user_input_error if the subcommand is unknown.
+     * \param[in] arguments The command line arguments (a copy, because response files are expanded in place).
      * \details
      *
+     * First, response files are expanded if enabled (see sharg::parser::enable_response_files).
      * This function adds all command line parameters to the format_arguments member variable
      * to take advantage of the vector functionality later on. Additionally,
      * the format member variable is set, depending on which parameters are given
@@ -805,10 +1142,12 @@ private:
      *
      * If `--export-help` is specified with a value other than html, man, cwl or ctd, an sharg::parser_error is thrown.
      */
-    void determine_format_and_subcommand()
+    void determine_format_and_subcommand(std::vector<std::string_view> arguments)
     {
         assert(!arguments.empty());
 
+        response_files.expand(arguments, response_syntax);
+
         auto it = arguments.begin();
         std::string_view arg{*it};
 
@@ -816,7 +1155,7 @@ private:
 
         // Helper function for reading the next argument. This makes it more obvious that we are
         // incrementing `it` (version-check, and export-help).
-        auto read_next_arg = [this, &it, &arg]() -> bool
+        auto read_next_arg = [&arguments, &it, &arg]() -> bool
         {
             assert(it != arguments.end());
 
@@ -828,22 +1167,29 @@ private:
         };
 
         // Helper function for finding and processing subcommands.
-        auto found_subcommand = [this, &it, &arg]() -> bool
+        auto found_subcommand = [this, &arguments, &it, &arg]() -> bool
         {
             if (subcommands.empty())
                 return false;
 
             if (std::ranges::find(subcommands, arg) != subcommands.end())
             {
-                sub_parser = std::make_unique<parser>(info.app_name + "-" + arg.data(),
-                                                      std::vector<std::string>{it, arguments.end()},
+                sub_parser = std::make_unique<parser>(info.app_name + "-" + std::string{arg},
+                                                      std::vector<std::string>{},
                                                       update_notifications::off);
+                // The sub-parser is owned by this parser and can therefore refer to its arguments.
+                sub_parser->arguments.assign(it, arguments.end());
 
                 // Add the original calls to the front, e.g. ["raptor"],
                 // s.t. ["raptor", "build"] will be the list after constructing the subparser
                 sub_parser->executable_name.insert(sub_parser->executable_name.begin(),
                                                    executable_name.begin(),
                                                    executable_name.end());
+                sub_parser->parent_executable_name_size = executable_name.size();
+                sub_parser->validation_deadline = validation_deadline;
+                sub_parser->async_validation = async_validation;
+                sub_parser->version_check_exit_budget = version_check_exit_budget;
+                sub_parser->update_feed_url = update_feed_url;
                 return true;
             }
             else
@@ -869,7 +1215,7 @@ private:
         for (; read_next_arg();)
         {
             // The argument is a known option.
-            if (options.contains(std::string{arg}))
+            if (options.contains(arg))
             {
                 // No futher checks are needed.
                 format_arguments.emplace_back(arg);
@@ -1040,6 +1386,9 @@ private:
 
         if (!config.default_message.empty())
             throw design_error{"A flag may not have a default message because the default is always `false`."};
+
+        if (config.list_separator != '\0')
+            throw design_error{"A flag may not have a list separator because it does not take a value."};
     }
 
     //!brief Verify the configuration given to a sharg::parser::add_positional_option call.
@@ -1062,6 +1411,26 @@ private:
 
         if (!config.default_message.empty())
             throw design_error{"A positional option may not have a default message because it is always required."};
+
+        if (config.list_separator != '\0')
+            throw design_error{"A positional option may not have a list separator. Positional list options take all "
+                               "remaining arguments."};
+    }
+
+    /*!\brief Stores a function that restores the current value of `value`, see sharg::parser::reset.
+     * \param[in] value The option value; values of types that are not copyable are not restored.
+     */
+    template <typename option_type>
+    void store_default_value(option_type & value)
+    {
+        if constexpr (std::copyable<option_type>)
+        {
+            reset_operations.push_back(
+                [&value, default_value = value]()
+                {
+                    value = default_value;
+                });
+        }
     }
 
     /*!\brief Throws a sharg::design_error if parse() was already called.
@@ -1090,7 +1459,7 @@ private:
     {
         // Before creating the detail::version_checker, we have to make sure that
         // malicious code cannot be injected through the app name.
-        if (!std::regex_match(info.app_name, app_name_regex))
+        if (!app_name_regex::match(info.app_name))
         {
             throw design_error{("The application name must only contain alpha-numeric characters or '_' and '-' "
                                 "(regex: \"^[a-zA-Z0-9_-]+$\").")};
@@ -1098,7 +1467,7 @@ private:
 
         for (auto & sub : this->subcommands)
         {
-            if (!std::regex_match(sub, app_name_regex))
+            if (!app_name_regex::match(sub))
             {
                 throw design_error{"The subcommand name must only contain alpha-numeric characters or '_' and '-' "
                                    "(regex: \"^[a-zA-Z0-9_-]+$\")."};
@@ -1106,21 +1475,78 @@ private:
         }
     }
 
+    /*!\brief Parses `arguments_to_parse` and returns the processed format instead of calling std::exit.
+     * \details
+     * Resets the parser first if sharg::parser::parse was called before.
+     */
+    parse_outcome parse_without_exit(std::vector<std::string_view> arguments_to_parse, std::ostream & stream)
+    {
+        if (arguments_to_parse.empty())
+            throw design_error{"The arguments must contain at least the name of the executable."};
+
+        if (parse_was_called)
+            reset();
+        else
+            verify_app_and_subcommand_names();
+
+        parse_was_called = true;
+
+        determine_format_and_subcommand(std::move(arguments_to_parse));
+
+        for (auto & operation : operations)
+            operation();
+
+        run_version_check();
+
+        parse_format(stream);
+
+        return std::visit(
+            []<typename format_t>(format_t const &)
+            {
+                if constexpr (std::same_as<format_t, detail::format_parse>)
+                    return parse_outcome::parsed;
+                else if constexpr (std::same_as<format_t, detail::format_version>)
+                    return parse_outcome::version_printed;
+                else if constexpr (std::same_as<format_t, detail::format_copyright>)
+                    return parse_outcome::copyright_printed;
+                else if constexpr (std::same_as<format_t, detail::format_help>
+                                   || std::same_as<format_t, detail::format_short_help>)
+                    return parse_outcome::help_printed;
+                else
+                    return parse_outcome::help_exported;
+            },
+            format);
+    }
+
     /*!\brief Runs the version check if the user has not disabled it.
      * \details
      * If the user has not disabled the version check, the function will start a detached thread that will call the
      * sharg::detail::version_checker and print a message if a new version is available.
+     * The version check is run at most once, even if sharg::parser::parse is called multiple times.
      */
     inline void run_version_check()
     {
+        if (std::exchange(version_check_was_run, true))
+            return;
+
+        // Most processes skip the version check without constructing a detail::version_checker.
+        std::optional<bool> const decision =
+            detail::version_checker::decide_without_cookie(info.app_name,
+                                                           version_check_dev_decision,
+                                                           version_check_user_decision);
+
+        if (decision.has_value() && !*decision)
+            return;
+
         detail::version_checker app_version{info.app_name, info.version, info.url};
+        app_version.feed = detail::update_feed::select(update_feed_url);
 
         if (app_version.decide_if_check_is_performed(version_check_dev_decision, version_check_user_decision))
         {
             // must be done before calling parse on the format because this might std::exit
             std::promise<bool> app_version_prom;
             version_check_future = app_version_prom.get_future();
-            app_version(std::move(app_version_prom));
+            app_version(std::move(app_version_prom), version_check_cancellation);
         }
     }
 
@@ -1131,21 +1557,78 @@ private:
      * \throws sharg::too_many_arguments if the command line call contained more arguments than expected.
      * \throws sharg::too_few_arguments if the command line call contained less arguments than expected.
      * \throws sharg::validation_error if the argument was not excepted by the provided validator.
+     * \param[in] stream The stream that the special formats (help, version, ...) print to.
      * \details
      * This function calls the parse function of the format member variable.
      */
-    inline void parse_format()
+    inline void parse_format(std::ostream & stream)
     {
-        auto format_parse_fn = [this]<typename format_t>(format_t & f)
+        auto format_parse_fn = [this, &stream]<typename format_t>(format_t & f)
         {
+            if constexpr (!std::same_as<format_t, detail::format_parse>)
+                f.stream = &stream;
+            else if (async_validation)
+                f.enable_async_validation();
+
             if constexpr (std::same_as<format_t, detail::format_tdl>)
                 f.parse(info, executable_name);
             else
                 f.parse(info);
         };
 
+        detail::deadline::scope const deadline_scope{validation_deadline};
         std::visit(std::move(format_parse_fn), format);
     }
+
+    /*!\brief Waits for asynchronous validations, also of the sub-parser, and returns the first error that
+     *        sharg::parser::wait_validated did not throw.
+     * \returns The exception, or `nullptr` if there is none.
+     */
+    std::exception_ptr unobserved_validation_error()
+    {
+        std::exception_ptr error{};
+
+        if (detail::format_parse const * const parse_format = std::get_if<detail::format_parse>(&format))
+            error = parse_format->unobserved_validation_error();
+
+        // The values of the sub-parser are parsed after the ones of this parser. Its error is observed in any case.
+        if (sub_parser != nullptr)
+        {
+            std::exception_ptr sub_parser_error = sub_parser->unobserved_validation_error();
+
+            if (error == nullptr)
+                error = std::move(sub_parser_error);
+        }
+
+        return error;
+    }
+
+    //!\brief Prints the error of sharg::parser::unobserved_validation_error and exits; see the destructor.
+    void report_unobserved_validation_error() noexcept
+    {
+        std::exception_ptr const error = unobserved_validation_error();
+
+        if (error == nullptr)
+            return;
+
+        try
+        {
+            std::rethrow_exception(error);
+        }
+        catch (std::exception const & exception)
+        {
+            std::cerr << "[" << info.app_name << "] The value validation failed, but the application did not call "
+                      << "sharg::parser::wait_validated: " << exception.what() << '\n';
+        }
+        catch (...)
+        {
+            std::cerr << "[" << info.app_name << "] The value validation failed, but the application did not call "
+                      << "sharg::parser::wait_validated.\n";
+        }
+
+        if (std::uncaught_exceptions() == 0)
+            std::exit(EXIT_FAILURE);
+    }
 };
 
 } // namespace sharg
@@ -11,13 +11,29 @@
 
 #include <algorithm>
 #include <any>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
 #include <exception>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <ranges>
 #include <regex>
-
+#include <thread>
+#include <tuple>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <sharg/detail/deadline.hpp>
+#include <sharg/detail/file_probe.hpp>
+#include <sharg/detail/mapped_file.hpp>
+#include <sharg/detail/regex.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
+#include <sharg/detail/suffix_matcher.hpp>
 #include <sharg/detail/to_string.hpp>
 #include <sharg/exceptions.hpp>
 
@@ -56,6 +72,45 @@ concept validator = std::copyable<std::remove_cvref_t<validator_type>> &&
                     };
 // clang-format on
 
+/*!\brief How expensive a validator is, see sharg::validator_cost_v.
+ * \ingroup validators
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class validator_cost : uint8_t
+{
+    //!\brief A few comparisons or a lookup, e.g. sharg::arithmetic_range_validator.
+    cheap,
+    //!\brief Computation that depends on the size of the value, e.g. sharg::regex_validator.
+    cpu,
+    //!\brief Accesses the file system or other resources, e.g. sharg::input_file_validator.
+    io
+};
+
+/*!\brief The cost of the validator `validator_type`.
+ * \ingroup validators
+ * \tparam validator_type The validator.
+ *
+ * \details
+ *
+ * The cost is the static member `validator_type::cost` if it exists, and sharg::validator_cost::cpu otherwise. It can
+ * also be specialised for validators that cannot be modified.
+ *
+ * Chained validators (see sharg::operator|()), sharg::all_of and sharg::any_of evaluate cheaper validators first.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <typename validator_type>
+inline constexpr validator_cost validator_cost_v = validator_cost::cpu;
+
+//!\cond
+template <typename validator_type>
+    requires requires {
+        { std::remove_cvref_t<validator_type>::cost } -> std::convertible_to<validator_cost>;
+    }
+inline constexpr validator_cost validator_cost_v<validator_type> = std::remove_cvref_t<validator_type>::cost;
+//!\endcond
+
 /*!\brief A validator that checks whether a number is inside a given range.
  * \ingroup validators
  * \implements sharg::validator
@@ -81,6 +136,9 @@ public:
     //!\brief The type of value that this validator invoked upon.
     using option_value_type = option_value_t;
 
+    //!\brief Comparing a value to the bounds is cheap.
+    static constexpr validator_cost cost{validator_cost::cheap};
+
     /*!\brief The constructor.
      * \param[in] min_ Minimum set for the range to test.
      * \param[in] max_ Maximum set for the range to test.
@@ -166,6 +224,12 @@ private:
  *
  * \include test/snippet/validators_2.cpp
  *
+ * If there are more than value_list_validator::hash_threshold valid values and `std::hash` is specialised for the
+ * option value type, the values are looked up in a hash table instead of being searched linearly. Large lists of
+ * valid values, e.g. all contig names of a reference genome, can be read from a file via
+ * sharg::value_list_validator::from_file. The help page and error messages only list the first
+ * value_list_validator::max_listed_values values. Copies of a validator share the valid values.
+ *
  * \remark For a complete overview, take a look at \ref parser
  *
  * \stableapi{Since version 1.0.}
@@ -177,6 +241,15 @@ public:
     //!\brief Type of values that are tested by validator
     using option_value_type = option_value_t;
 
+    //!\brief Looking up a value is cheap.
+    static constexpr validator_cost cost{validator_cost::cheap};
+
+    //!\brief Above this number of valid values, a hash table is used to look up values.
+    static constexpr size_t hash_threshold{16u};
+
+    //!\brief The maximal number of valid values printed in help page and error messages.
+    static constexpr size_t max_listed_values{20u};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -199,7 +272,9 @@ public:
         requires std::constructible_from<option_value_type, std::ranges::range_rvalue_reference_t<range_type>>
     value_list_validator(range_type rng) // No &&, because rng will be moved.
     {
-        std::move(rng.begin(), rng.end(), std::back_inserter(values));
+        value_table new_table{};
+        std::move(rng.begin(), rng.end(), std::back_inserter(new_table.values));
+        set_table(std::move(new_table));
     }
 
     /*!\brief Constructing from a parameter pack.
@@ -214,7 +289,48 @@ public:
         requires ((std::constructible_from<option_value_type, option_types> && ...))
     value_list_validator(option_types &&... opts)
     {
-        (values.emplace_back(std::forward<option_types>(opts)), ...);
+        value_table new_table{};
+        (new_table.values.emplace_back(std::forward<option_types>(opts)), ...);
+        set_table(std::move(new_table));
+    }
+
+    /*!\brief Reads the valid values from a file.
+     * \param[in] path The path of the file.
+     * \throws sharg::user_input_error if the file cannot be read.
+     *
+     * \details
+     *
+     * Each non-empty line contains one value; everything after the first tab is ignored. Hence, the file may be a
+     * plain list of values or, for example, a FASTA index (`.fai`) whose first column contains the contig names.
+     * The file is mapped into memory and only read once.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    static value_list_validator from_file(std::filesystem::path const & path)
+        requires std::constructible_from<option_value_type, std::string_view>
+    {
+        detail::mapped_file file{path, "value list file"};
+        std::string_view const content{file.begin(), static_cast<size_t>(file.end() - file.begin())};
+        value_table new_table{};
+
+        for (size_t line_begin = 0; line_begin < content.size();)
+        {
+            size_t const line_end = std::min(content.find('\n', line_begin), content.size());
+            std::string_view line = content.substr(line_begin, line_end - line_begin);
+            line = line.substr(0, line.find('\t'));
+
+            if (line.ends_with('\r'))
+                line.remove_suffix(1u);
+
+            if (!line.empty())
+                new_table.values.emplace_back(line);
+
+            line_begin = line_end + 1u;
+        }
+
+        value_list_validator validator{};
+        validator.set_table(std::move(new_table));
+        return validator;
     }
     //!\}
 
@@ -227,8 +343,8 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        if (!(std::find(values.begin(), values.end(), cmp) != values.end()))
-            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", values, ".")};
+        if (!contains(cmp))
+            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", listed_values(), ".")};
     }
 
     /*!\brief Tests whether every element in \p range lies inside values.
@@ -259,12 +375,107 @@ public:
      */
     std::string get_help_page_message() const
     {
-        return detail::to_string("Value must be one of ", values, ".");
+        return detail::to_string("Value must be one of ", listed_values(), ".");
     }
 
 private:
-    //!\brief Minimum of the range to test.
-    std::vector<option_value_type> values{};
+    // clang-format off
+    //!\brief Whether `std::hash` is specialised for the option value type.
+    static constexpr bool is_hashable = requires (option_value_type const & value)
+    {
+        { std::hash<option_value_type>{}(value) } -> std::convertible_to<size_t>;
+    };
+    // clang-format on
+
+    //!\brief Marks an empty bucket.
+    static constexpr size_t empty_bucket{std::numeric_limits<size_t>::max()};
+
+    //!\brief The valid values and the hash table.
+    struct value_table
+    {
+        //!\brief The valid values.
+        std::vector<option_value_type> values{};
+        //!\brief The hash table: indices into values; only used if there are more than hash_threshold values.
+        std::vector<size_t> buckets{};
+
+        //!\brief Returns the bucket that a value with hash value `hash` is looked up first.
+        size_t first_bucket(size_t const hash) const noexcept
+        {
+            // Fibonacci hashing; std::hash is the identity for integers in many standard libraries.
+            return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ULL) >> 32)
+                 & (buckets.size() - 1u);
+        }
+    };
+
+    //!\brief The valid values; shared by all copies since it is immutable.
+    std::shared_ptr<value_table const> table{std::make_shared<value_table const>()};
+
+    //!\brief Builds the hash table of `new_table` if there are more than hash_threshold values and stores it.
+    void set_table(value_table && new_table)
+    {
+        if constexpr (is_hashable)
+        {
+            std::vector<option_value_type> const & values = new_table.values;
+            std::vector<size_t> & buckets = new_table.buckets;
+
+            if (values.size() > hash_threshold)
+            {
+                buckets.assign(std::bit_ceil(2u * values.size()), empty_bucket);
+
+                for (size_t index = 0; index < values.size(); ++index)
+                {
+                    size_t bucket = new_table.first_bucket(std::hash<option_value_type>{}(values[index]));
+
+                    while (buckets[bucket] != empty_bucket && !(values[buckets[bucket]] == values[index]))
+                        bucket = (bucket + 1u) & (buckets.size() - 1u);
+
+                    if (buckets[bucket] == empty_bucket)
+                        buckets[bucket] = index;
+                }
+            }
+        }
+
+        table = std::make_shared<value_table const>(std::move(new_table));
+    }
+
+    //!\brief Whether `cmp` is a valid value.
+    bool contains(option_value_type const & cmp) const
+    {
+        std::vector<option_value_type> const & values = table->values;
+        std::vector<size_t> const & buckets = table->buckets;
+
+        if constexpr (is_hashable)
+        {
+            if (!buckets.empty())
+            {
+                for (size_t bucket = table->first_bucket(std::hash<option_value_type>{}(cmp));
+                     buckets[bucket] != empty_bucket;
+                     bucket = (bucket + 1u) & (buckets.size() - 1u))
+                {
+                    if (values[buckets[bucket]] == cmp)
+                        return true;
+                }
+
+                return false;
+            }
+        }
+
+        return std::find(values.begin(), values.end(), cmp) != values.end();
+    }
+
+    //!\brief Returns the valid values for help page and error messages, truncated after max_listed_values values.
+    std::string listed_values() const
+    {
+        std::vector<option_value_type> const & values = table->values;
+
+        if (values.size() <= max_listed_values)
+            return detail::to_string(values);
+
+        std::string result = detail::to_string(values | std::views::take(max_listed_values));
+        result.pop_back(); // ']'
+        result += detail::to_string(", ...] (", values.size(), " values)");
+        return result;
+    }
 };
 
 /*!\name Type deduction guides
@@ -314,6 +525,9 @@ public:
     //!\brief Type of values that are tested by validator.
     using option_value_type = std::string;
 
+    //!\brief The validators access the file system.
+    static constexpr validator_cost cost{validator_cost::io};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -344,6 +558,19 @@ public:
      * \throws sharg::validation_error
      *
      * \details
+     *
+     * Validating a path mostly waits for the file system, e.g. on network file systems. Hence, if there are at least
+     * 2 * file_validator_base::min_paths_per_thread paths, the validators of Sharg validate them concurrently by up to
+     * file_validator_base::max_threads threads. Paths that are lexically equal are only validated once.
+     * As for sequential validation, the exception of the first invalid path in input order is thrown.
+     * Paths are validated sequentially by derived classes of other types, whose
+     * operator()(std::filesystem::path const &) need not be thread-safe, see validates_concurrently().
+     *
+     * On Linux, sharg::input_file_validator and sharg::input_directory_validator can instead probe the type and
+     * readability of all paths as batches of io_uring requests (`statx` and `openat`) and then validate the paths
+     * sequentially, see sharg::input_file_validator::use_io_uring. If io_uring is unavailable, the paths are validated
+     * concurrently as described above. Both ways give the same results and error messages.
+     *
      * \experimentalapi{Experimental since version 1.0.}
      */
     template <std::ranges::forward_range range_type>
@@ -351,15 +578,80 @@ public:
                   && !std::convertible_to<range_type, std::filesystem::path const &>)
     void operator()(range_type const & v) const
     {
-        std::for_each(v.begin(),
-                      v.end(),
-                      [&](auto cmp)
-                      {
-                          this->operator()(cmp);
-                      });
+        std::vector<std::filesystem::path> paths{};
+
+        for (auto && entry : v)
+            paths.emplace_back(entry);
+
+        validate_paths(paths);
+    }
+
+    //!\brief The minimal number of paths that a thread validates in operator()(range_type const &).
+    static constexpr size_t min_paths_per_thread{32u};
+
+    //!\brief The maximal number of threads that validate paths in operator()(range_type const &).
+    static constexpr size_t max_threads{16u};
+
+    /*!\brief Returns the number of system calls issued to check the type and access permissions of paths.
+     *
+     * \details
+     *
+     * The number is shared by all validators and threads and counts from the program start or the last call of
+     * reset_syscall_count(). For example, validating an existing, readable input file issues two system calls on
+     * POSIX systems.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    static size_t syscall_count() noexcept
+    {
+        return detail::file_probe::syscall_count();
+    }
+
+    /*!\brief Resets the number of system calls returned by syscall_count() to 0.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    static void reset_syscall_count() noexcept
+    {
+        detail::file_probe::reset_syscall_count();
     }
 
 protected:
+    /*!\brief Whether operator()(range_type const &) probes the type and readability of all paths at once.
+     * \details
+     * See detail::file_probe::batch. Only useful if operator()(std::filesystem::path const &) only needs the type
+     * and readability of the path.
+     */
+    virtual bool probes_in_batches() const noexcept
+    {
+        return false;
+    }
+
+    /*!\brief Whether operator()(range_type const &) may call operator()(std::filesystem::path const &) concurrently.
+     * \details
+     * Only the validators of Sharg return `true`, and only if they are not derived from, i.e. if their
+     * operator()(std::filesystem::path const &) is known to be thread-safe.
+     */
+    virtual bool validates_concurrently() const noexcept
+    {
+        return false;
+    }
+
+    //!\brief Whether the input validators probe lists of paths with io_uring; set by their `use_io_uring()`.
+    bool io_uring_enabled{false};
+
+    /*!\brief Sets the valid extensions.
+     * \param[in] valid_extensions The valid extensions.
+     */
+    void set_extensions(std::vector<std::string> valid_extensions)
+    {
+        extensions_str = detail::to_string(valid_extensions);
+        extension_matcher = detail::suffix_matcher{valid_extensions};
+        matched_extensions = valid_extensions;
+        extensions = std::move(valid_extensions);
+    }
+
     /*!\brief Validates the given filename path based on the specified extensions.
      * \param path The filename path.
      * \throws sharg::validation_error if the specified extensions don't match the given path, or
@@ -395,8 +687,13 @@ protected:
             return case_insensitive_string_ends_with(file_path, ext);
         };
 
+        // The extension_matcher is outdated if a derived class assigned the extensions directly.
+        bool const is_valid = matched_extensions == extensions
+                                ? extension_matcher.matches(file_path)
+                                : std::ranges::any_of(extensions, case_insensitive_ends_with);
+
         // Check if requested extension is present.
-        if (std::find_if(extensions.begin(), extensions.end(), case_insensitive_ends_with) == extensions.end())
+        if (!is_valid)
         {
             throw validation_error{"Expected one of the following valid extensions: " + extensions_str + "! Got "
                                    + all_extensions + " instead!"};
@@ -409,23 +706,30 @@ protected:
      *         std::filesystem::filesystem_error on underlying OS API errors.
      */
     void validate_readability(std::filesystem::path const & path) const
+    {
+        validate_readability(path, detail::file_probe::type(path));
+    }
+
+    /*!\brief Checks if the given path of known type is readable.
+     * \param path The path to check.
+     * \param path_type The type of the path as determined by detail::file_probe::type.
+     * \throws sharg::validation_error if the path is not readable.
+     */
+    void validate_readability(std::filesystem::path const & path, detail::file_type const path_type) const
     {
         // Check if input directory is readable.
-        if (std::filesystem::is_directory(path))
+        if (path_type == detail::file_type::directory)
         {
-            std::error_code ec{};
-            std::filesystem::directory_iterator{path, ec}; // if directory iterator cannot be created, ec will be set.
-            if (static_cast<bool>(ec))
+            if (!detail::file_probe::is_readable(path, path_type))
                 throw validation_error{"Cannot read the directory \"" + path.string() + "\"!"};
         }
         else
         {
             // Must be a regular file.
-            if (!std::filesystem::is_regular_file(path))
+            if (path_type != detail::file_type::regular)
                 throw validation_error{"Expected a regular file \"" + path.string() + "\"!"};
 
-            std::ifstream file{path};
-            if (!file.is_open() || !file.good())
+            if (!detail::file_probe::is_readable(path, path_type))
                 throw validation_error{"Cannot read the file \"" + path.string() + "\"!"};
         }
     }
@@ -437,25 +741,30 @@ protected:
      * \throws std::filesystem::filesystem_error on underlying OS API errors.
      */
     void validate_writeability(std::filesystem::path const & path) const
+    {
+        validate_writeability(path, detail::file_probe::type(path));
+    }
+
+    /*!\brief Checks if the given path of known type is writable.
+     * \param path The path to check.
+     * \param path_type The type of the path as determined by detail::file_probe::type.
+     * \throws sharg::validation_error if the given path is a directory.
+     * \throws sharg::validation_error if the file could not be opened for writing.
+     *
+     * \details
+     *
+     * Neither an existing file nor its directory are modified; see detail::file_probe::is_writable.
+     */
+    void validate_writeability(std::filesystem::path const & path, detail::file_type const path_type) const
     {
         // Contingency check. This case should already be handled by the output_file_validator.
-        // Opening a file handle on a directory would delete its contents.
         // LCOV_EXCL_START
-        if (std::filesystem::is_directory(path))
+        if (path_type == detail::file_type::directory)
             throw validation_error{"\"" + path.string() + "\" is a directory. Cannot validate writeability."};
         // LCOV_EXCL_STOP
 
-        std::ofstream file{path};
-        sharg::detail::safe_filesystem_entry file_guard{path};
-
-        bool is_open = file.is_open();
-        bool is_good = file.good();
-        file.close();
-
-        if (!is_good || !is_open)
+        if (!detail::file_probe::is_writable(path, path_type))
             throw validation_error{"Cannot write \"" + path.string() + "\"!"};
-
-        file_guard.remove();
     }
 
     //!\brief Returns the information of valid file extensions.
@@ -492,6 +801,128 @@ protected:
 
     //!\brief The extension range as a std:;string for pretty printing.
     std::string extensions_str{};
+
+private:
+    //!\brief Matches the extensions; set by set_extensions.
+    detail::suffix_matcher extension_matcher{};
+
+    //!\brief The extensions that extension_matcher matches; differs from `extensions` if they were assigned directly.
+    std::vector<std::string> matched_extensions{};
+
+    //!\brief Hashes a std::filesystem::path.
+    struct path_hash
+    {
+        //!\brief Returns the hash value of `path`.
+        size_t operator()(std::filesystem::path const & path) const noexcept
+        {
+            return std::filesystem::hash_value(path);
+        }
+    };
+
+    /*!\brief Validates `paths`, concurrently if there are enough paths.
+     * \param[in] paths The paths to validate.
+     * \throws The exception of the first path in `paths` that is not valid.
+     */
+    void validate_paths(std::vector<std::filesystem::path> const & paths) const
+    {
+        size_t const path_count = paths.size();
+        size_t const thread_count = std::min(max_threads, path_count / min_paths_per_thread);
+
+        if (thread_count <= 1u)
+        {
+            for (std::filesystem::path const & path : paths)
+                (*this)(path);
+
+            return;
+        }
+
+        if (probes_in_batches())
+        {
+            // The probed paths are validated sequentially without further system calls.
+            detail::file_probe::batch const probed{paths};
+
+            if (probed.is_complete())
+            {
+                for (std::filesystem::path const & path : paths)
+                    (*this)(path);
+
+                return;
+            }
+        }
+
+        if (!validates_concurrently())
+        {
+            for (std::filesystem::path const & path : paths)
+                (*this)(path);
+
+            return;
+        }
+
+        // Equal paths are validated once; validating an output file creates it.
+        std::vector<size_t> first_occurrence(path_count);
+        std::unordered_map<std::filesystem::path, size_t, path_hash> occurrences{};
+        occurrences.reserve(path_count);
+
+        for (size_t i = 0; i < path_count; ++i)
+            first_occurrence[i] = occurrences.emplace(paths[i], i).first->second;
+
+        std::vector<std::exception_ptr> errors(path_count);
+        std::atomic<size_t> next_path{0u};
+        std::atomic<size_t> first_error{path_count};
+
+        // Paths are claimed in input order; paths after the first invalid one need not be validated.
+        auto validate = [&, timeout = detail::deadline::timeout()]()
+        {
+            detail::deadline::scope const deadline_scope{timeout};
+
+            for (size_t i = next_path++; i < path_count && i < first_error.load(); i = next_path++)
+            {
+                if (first_occurrence[i] != i)
+                    continue;
+
+                try
+                {
+                    (*this)(paths[i]);
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+
+                    for (size_t error = first_error.load(); i < error && !first_error.compare_exchange_weak(error, i);)
+                    {}
+                }
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads{};
+            threads.reserve(thread_count - 1u);
+
+            for (size_t i = 1; i < thread_count; ++i)
+                threads.emplace_back(validate);
+
+            validate();
+        } // Joins the threads.
+
+        for (size_t i = 0; i < path_count; ++i)
+            if (errors[first_occurrence[i]])
+                std::rethrow_exception(errors[first_occurrence[i]]);
+    }
+};
+
+/*!\brief How sharg::input_file_validator prefetches validated files, see sharg::input_file_validator::prefetch.
+ * \ingroup validators
+ * \details
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+enum class prefetch_mode
+{
+    //!\brief Files are not prefetched.
+    none,
+    //!\brief Files are prefetched via `posix_fadvise(POSIX_FADV_WILLNEED)`.
+    willneed,
+    //!\brief Files are prefetched via `readahead` on Linux and via `posix_fadvise(POSIX_FADV_WILLNEED)` otherwise.
+    readahead
 };
 
 /*!\brief A validator that checks if a given path is a valid input file.
@@ -541,8 +972,7 @@ public:
      */
     explicit input_file_validator(std::vector<std::string> extensions) : file_validator_base{}
     {
-        file_validator_base::extensions_str = detail::to_string(extensions);
-        file_validator_base::extensions = std::move(extensions);
+        file_validator_base::set_extensions(std::move(extensions));
     }
 
     // Import base class constructor.
@@ -564,14 +994,19 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(file))
+            detail::file_type const file_type = detail::file_probe::type(file);
+
+            if (file_type == detail::file_type::not_found)
                 throw validation_error{"The file \"" + file.string() + "\" does not exist!"};
 
             // Check if file is regular and can be opened for reading.
-            validate_readability(file);
+            validate_readability(file, file_type);
 
             // Check extension.
             validate_filename(file);
+
+            if (prefetch_budget != nullptr && prefetch_budget->remaining.load(std::memory_order_relaxed) > 0u)
+                prefetch_file(file);
         }
         // LCOV_EXCL_START
         catch (std::filesystem::filesystem_error & ex)
@@ -595,6 +1030,105 @@ public:
              + ((valid_extensions_help_page_message().empty()) ? std::string{} : std::string{" "})
              + valid_extensions_help_page_message();
     }
+
+    //!\brief The default of the `byte_budget` of prefetch(): 256 MiB.
+    static constexpr uint64_t default_prefetch_budget{uint64_t{256u} << 20};
+
+    /*!\brief Asks the operating system to read validated files into the page cache in the background.
+     * \param[in] mode How files are prefetched; sharg::prefetch_mode::none disables prefetching.
+     * \param[in] byte_budget The maximal number of bytes that are prefetched in total.
+     * \returns `*this`, e.g. to pass `input_file_validator{{"bam"}}.prefetch(sharg::prefetch_mode::willneed)` to
+     *          sharg::config.
+     *
+     * \details
+     *
+     * Validating an input file does not read it. With prefetching, the beginning of every valid file is read in the
+     * background while the application continues, e.g. to build an index, until `byte_budget` bytes are requested in
+     * total. Hence, the files are read in validation order, and a file larger than the remaining budget is only
+     * partially prefetched. Copies of the validator share the budget.
+     *
+     * Prefetching a file opens it and issues three additional system calls. Errors are ignored.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    input_file_validator & prefetch(prefetch_mode const mode, uint64_t const byte_budget = default_prefetch_budget)
+    {
+        if (mode == prefetch_mode::none)
+            prefetch_budget.reset();
+        else
+            prefetch_budget = std::make_shared<budget>(mode, byte_budget);
+
+        return *this;
+    }
+
+    /*!\brief Probes lists of paths with batches of io_uring requests on Linux.
+     * \param[in] enable Whether to use io_uring.
+     * \returns `*this`, e.g. to pass `input_file_validator{{"fq"}}.use_io_uring()` to sharg::config.
+     *
+     * \details
+     *
+     * By default, lists of many paths are validated concurrently by several threads, see
+     * sharg::file_validator_base::operator()(range_type const &). With io_uring, the type and readability of all
+     * paths are probed by `statx` and `openat` requests in batches, which takes a few system calls per batch instead
+     * of two per path. Note that each file is opened and closed, which, for example, may trigger virus scanners or
+     * recalls of files from tape storage, and that io_uring is not necessarily faster than the threads.
+     * If io_uring is unavailable, the paths are validated concurrently.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    input_file_validator & use_io_uring(bool const enable = true) noexcept
+    {
+        io_uring_enabled = enable;
+        return *this;
+    }
+
+protected:
+    //!\copydoc sharg::file_validator_base::probes_in_batches
+    virtual bool probes_in_batches() const noexcept override
+    {
+        return io_uring_enabled;
+    }
+
+    //!\copydoc sharg::file_validator_base::validates_concurrently
+    virtual bool validates_concurrently() const noexcept override
+    {
+        return typeid(*this) == typeid(input_file_validator);
+    }
+
+private:
+    //!\brief The prefetch mode and the remaining bytes that may be prefetched.
+    struct budget
+    {
+        //!\brief Constructs the budget of `bytes` bytes.
+        budget(prefetch_mode const mode, uint64_t const bytes) : mode{mode}, remaining{bytes}
+        {}
+
+        prefetch_mode const mode;        //!< How files are prefetched.
+        std::atomic<uint64_t> remaining; //!< The remaining bytes.
+    };
+
+    //!\brief The budget shared by all copies, or `nullptr` if files are not prefetched.
+    std::shared_ptr<budget> prefetch_budget{};
+
+    //!\brief Prefetches the beginning of the valid input file `file` and reduces the budget.
+    void prefetch_file(std::filesystem::path const & file) const
+    {
+        // Claims the bytes to prefetch of a file of size `file_size`. The lambda shares the budget because it may
+        // outlive the validator if the file system does not respond within the timeout.
+        auto claim = [budget = prefetch_budget](uint64_t const file_size)
+        {
+            std::atomic<uint64_t> & remaining = budget->remaining;
+            uint64_t available = remaining.load(std::memory_order_relaxed);
+
+            while (available > 0u
+                   && !remaining.compare_exchange_weak(available, available - std::min(file_size, available)))
+            {}
+
+            return std::min(file_size, available);
+        };
+
+        detail::file_probe::prefetch(file, prefetch_budget->mode == prefetch_mode::readahead, claim);
+    }
 };
 
 /*!\brief Mode of an output file: Determines whether an existing file can be (silently) overwritten.
@@ -663,8 +1197,7 @@ public:
     explicit output_file_validator(output_file_open_options const mode, std::vector<std::string> const & extensions) :
         open_mode{mode}
     {
-        file_validator_base::extensions_str = detail::to_string(extensions);
-        file_validator_base::extensions = std::move(extensions);
+        file_validator_base::set_extensions(std::move(extensions));
     }
 
     /*!\brief Constructs from a given overwrite mode and a parameter pack of valid extensions.
@@ -720,16 +1253,18 @@ public:
      */
     virtual void operator()(std::filesystem::path const & file) const override
     {
-        if (std::filesystem::is_directory(file))
+        detail::file_type const file_type = detail::file_probe::type(file);
+
+        if (file_type == detail::file_type::directory)
             throw validation_error{"\"" + file.string() + "\" is a directory. Expected a file."};
 
         try
         {
-            if ((open_mode == output_file_open_options::create_new) && std::filesystem::exists(file))
+            if ((open_mode == output_file_open_options::create_new) && file_type != detail::file_type::not_found)
                 throw validation_error{"The file \"" + file.string() + "\" already exists!"};
 
             // Check if file has any write permissions.
-            validate_writeability(file);
+            validate_writeability(file, file_type);
 
             validate_filename(file);
         }
@@ -766,6 +1301,13 @@ public:
         }
     }
 
+protected:
+    //!\copydoc sharg::file_validator_base::validates_concurrently
+    virtual bool validates_concurrently() const noexcept override
+    {
+        return typeid(*this) == typeid(output_file_validator);
+    }
+
 private:
     //!\brief Stores the current mode of whether it is valid to overwrite the output file.
     output_file_open_options open_mode{output_file_open_options::create_new};
@@ -824,14 +1366,16 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(dir))
+            detail::file_type const dir_type = detail::file_probe::type(dir);
+
+            if (dir_type == detail::file_type::not_found)
                 throw validation_error{"The directory \"" + dir.string() + "\" does not exists!"};
 
-            if (!std::filesystem::is_directory(dir))
+            if (dir_type != detail::file_type::directory)
                 throw validation_error{"The path \"" + dir.string() + "\" is not a directory!"};
 
             // Check if directory has any read permissions.
-            validate_readability(dir);
+            validate_readability(dir, dir_type);
         }
         // LCOV_EXCL_START
         catch (std::filesystem::filesystem_error & ex)
@@ -854,6 +1398,34 @@ public:
     {
         return "An existing, readable path for the input directory.";
     }
+
+    /*!\brief Probes lists of paths with batches of io_uring requests on Linux.
+     * \param[in] enable Whether to use io_uring.
+     * \returns `*this`.
+     *
+     * \details
+     * See sharg::input_file_validator::use_io_uring.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    input_directory_validator & use_io_uring(bool const enable = true) noexcept
+    {
+        io_uring_enabled = enable;
+        return *this;
+    }
+
+protected:
+    //!\copydoc sharg::file_validator_base::probes_in_batches
+    virtual bool probes_in_batches() const noexcept override
+    {
+        return io_uring_enabled;
+    }
+
+    //!\copydoc sharg::file_validator_base::validates_concurrently
+    virtual bool validates_concurrently() const noexcept override
+    {
+        return typeid(*this) == typeid(input_directory_validator);
+    }
 };
 
 /*!\brief A validator that checks if a given path is a valid output directory.
@@ -907,10 +1479,20 @@ public:
      */
     virtual void operator()(std::filesystem::path const & dir) const override
     {
-        bool dir_exists = std::filesystem::exists(dir);
+        bool dir_exists = detail::deadline::run(dir,
+                                                [](std::filesystem::path const & path)
+                                                {
+                                                    return std::filesystem::exists(path);
+                                                });
         // Make sure the created dir is deleted after we are done.
-        std::error_code ec;
-        std::filesystem::create_directory(dir, ec); // does nothing and is not treated as error if path already exists.
+        std::error_code ec = detail::deadline::run(dir,
+                                                   [](std::filesystem::path const & path)
+                                                   {
+                                                       std::error_code error{};
+                                                       // Does nothing and is not an error if the path exists.
+                                                       std::filesystem::create_directory(path, error);
+                                                       return error;
+                                                   });
         // if error code was set or if dummy.txt could not be created within the output dir, throw an error.
         if (static_cast<bool>(ec))
             throw validation_error{"Cannot create directory: \"" + dir.string() + "\"!"};
@@ -949,19 +1531,303 @@ public:
     {
         return "A valid path for the output directory.";
     }
+
+protected:
+    //!\copydoc sharg::file_validator_base::validates_concurrently
+    virtual bool validates_concurrently() const noexcept override
+    {
+        return typeid(*this) == typeid(output_directory_validator);
+    }
 };
 
-/*!\brief A validator that checks if a matches a regular expression pattern.
+/*!\brief A validator that checks if the file system of an output path has enough free space.
  * \ingroup validators
  * \implements sharg::validator
  *
  * \details
  *
- * On construction, the validator must receive a pattern for a regular expression.
- * The pattern variable will be used for constructing a std::regex and the
- * validator will call std::regex_match on the command line argument.
- * Note: A regex_match will only return true if the strings matches the pattern
- * completely (in contrast to regex_search which also matches substrings).
+ * On construction, the validator receives the number of bytes and inodes (files and directories) that the output
+ * requires. The number of bytes may be a constant or computed on validation by a function, e.g. from the sizes of
+ * input files via sharg::free_space_validator::size_of. The class acts as a functor that throws a
+ * sharg::validation_error exception if the file system containing the given path, or its nearest existing ancestor
+ * if the path does not exist, has less space or fewer inodes available. This way, a tool fails at parse time instead
+ * of after hours of computation.
+ *
+ * The validator only checks the free space; combine it with a sharg::output_file_validator or a
+ * sharg::output_directory_validator to also check whether the path can be written:
+ *
+ * \include test/snippet/free_space_validator.cpp
+ *
+ * Options are validated in the order they were added to the parser, and options before positional options. Hence,
+ * an option whose value is used to compute the required bytes must be added before the validated option.
+ *
+ * Optionally, reserve() allocates the required bytes for the output file, see sharg::free_space_validator::reserve.
+ *
+ * \note The validator works on every type that can be implicitly converted to std::filesystem::path.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+class free_space_validator
+{
+public:
+    //!\brief Type of values that are tested by validator.
+    using option_value_type = std::string;
+
+    //!\brief The validator accesses the file system.
+    static constexpr validator_cost cost{validator_cost::io};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    free_space_validator() = default;                                         //!< Defaulted.
+    free_space_validator(free_space_validator const &) = default;             //!< Defaulted.
+    free_space_validator(free_space_validator &&) = default;                  //!< Defaulted.
+    free_space_validator & operator=(free_space_validator const &) = default; //!< Defaulted.
+    free_space_validator & operator=(free_space_validator &&) = default;      //!< Defaulted.
+    ~free_space_validator() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructs from a constant number of required bytes.
+     * \param[in] bytes The number of bytes that must be available.
+     * \param[in] inodes The number of inodes that must be available.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    explicit free_space_validator(uint64_t const bytes, uint64_t const inodes = 1u) :
+        constant_bytes{bytes},
+        required_inodes{inodes}
+    {}
+
+    /*!\brief Constructs from a function that computes the number of required bytes on validation.
+     * \tparam bytes_function_t The type of the function; must be invocable without arguments and return a number.
+     * \param[in] bytes_function The function that returns the number of bytes that must be available.
+     * \param[in] inodes The number of inodes that must be available.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    template <typename bytes_function_t>
+        requires std::invocable<bytes_function_t const &>
+                  && std::convertible_to<std::invoke_result_t<bytes_function_t const &>, uint64_t>
+    explicit free_space_validator(bytes_function_t bytes_function, uint64_t const inodes = 1u) :
+        bytes_function{std::move(bytes_function)},
+        required_inodes{inodes}
+    {}
+    //!\}
+
+    /*!\brief Whether to allocate the required bytes for the output file on validation.
+     * \param[in] enable Whether to allocate the required bytes.
+     * \returns `*this`, e.g. to pass `free_space_validator{size}.reserve()` to sharg::config.
+     *
+     * \details
+     *
+     * If enabled, a valid output file that does not exist is created, and the required bytes are allocated via
+     * `fallocate` with `FALLOC_FL_KEEP_SIZE`. The size of the file does not change, but its space cannot be used by
+     * others anymore. The space stays allocated as long as the file is not truncated; hence, the output file must be
+     * opened without truncating it, e.g. via `std::fstream{path, std::ios::in | std::ios::out}`. Paths of existing
+     * directories are not modified. If the system or the file system does not support allocating space, only the
+     * free space is checked.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    free_space_validator & reserve(bool const enable = true)
+    {
+        reserves = enable;
+        return *this;
+    }
+
+    /*!\brief Tests whether the file system of `path` has enough free space.
+     * \param path The output path to check.
+     * \throws sharg::validation_error if there is not enough space or not enough inodes available, or if the space
+     *         cannot be allocated. Might be nested with std::filesystem::filesystem_error on unhandled OS API errors.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void operator()(std::filesystem::path const & path) const
+    {
+        try
+        {
+            uint64_t const bytes = required_bytes();
+            detail::file_system_space const space = detail::file_probe::space(path);
+
+            if (space.available_bytes < bytes)
+            {
+                throw validation_error{"Not enough free space for \"" + path.string() + "\": " + to_size_string(bytes)
+                                       + " required, but only " + to_size_string(space.available_bytes)
+                                       + " available in \"" + space.path.string() + "\"!"};
+            }
+
+            if (space.available_inodes.has_value() && *space.available_inodes < required_inodes)
+            {
+                throw validation_error{"Not enough free inodes for \"" + path.string() + "\": "
+                                       + std::to_string(required_inodes) + " required, but only "
+                                       + std::to_string(*space.available_inodes) + " available in \""
+                                       + space.path.string() + "\"!"};
+            }
+
+            if (reserves && bytes > 0u)
+                reserve_space(path, bytes);
+        }
+        // LCOV_EXCL_START
+        catch (std::filesystem::filesystem_error & ex)
+        {
+            std::throw_with_nested(validation_error{"Unhandled filesystem error!"});
+        }
+        // LCOV_EXCL_STOP
+        catch (...)
+        {
+            std::rethrow_exception(std::current_exception());
+        }
+    }
+
+    /*!\brief Tests whether the file system of every path in list \p v has enough free space.
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range and the value type must
+     *                    be convertible to std::filesystem::path.
+     * \param  v          The input range to iterate over and check every element.
+     * \throws sharg::validation_error
+     *
+     * \details
+     *
+     * Every path must have the required space on its own, i.e. the space is not summed over paths on the same file
+     * system.
+     *
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    template <std::ranges::forward_range range_type>
+        requires (std::convertible_to<std::ranges::range_value_t<range_type>, std::filesystem::path const &>
+                  && !std::convertible_to<range_type, std::filesystem::path const &>)
+    void operator()(range_type const & v) const
+    {
+        std::for_each(v.begin(),
+                      v.end(),
+                      [&](auto cmp)
+                      {
+                          (*this)(cmp);
+                      });
+    }
+
+    /*!\brief Returns a message that can be appended to the (positional) options help page info.
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    std::string get_help_page_message() const
+    {
+        std::string message = bytes_function ? "The file system must have enough free space for the output."
+                                             : "The file system must have " + to_size_string(required_bytes())
+                                                   + " of free space.";
+
+        if (reserves)
+            message += " The space is reserved on validation.";
+
+        return message;
+    }
+
+    /*!\brief Returns the total size of the existing regular files in `paths`, e.g. to compute the required bytes.
+     * \tparam range_type The type of range; must model std::ranges::input_range and the value type must be
+     *                    convertible to std::filesystem::path.
+     * \param[in] paths The paths.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    template <std::ranges::input_range range_type>
+        requires std::convertible_to<std::ranges::range_reference_t<range_type>, std::filesystem::path const &>
+    static uint64_t size_of(range_type && paths)
+    {
+        uint64_t size{};
+
+        for (std::filesystem::path const & path : paths)
+        {
+            std::error_code error{};
+            uint64_t const file_size = std::filesystem::file_size(path, error);
+
+            if (!error)
+                size += file_size;
+        }
+
+        return size;
+    }
+
+private:
+    //!\brief The number of required bytes if it is constant.
+    uint64_t constant_bytes{};
+    //!\brief Computes the number of required bytes if it is not constant.
+    std::function<uint64_t()> bytes_function{};
+    //!\brief The number of required inodes.
+    uint64_t required_inodes{1u};
+    //!\brief Whether the required bytes are allocated on validation.
+    bool reserves{false};
+
+    //!\brief Returns the number of required bytes.
+    uint64_t required_bytes() const
+    {
+        return bytes_function ? bytes_function() : constant_bytes;
+    }
+
+    //!\brief Allocates `bytes` bytes for the file `path` unless it is a directory.
+    void reserve_space(std::filesystem::path const & path, uint64_t const bytes) const
+    {
+        detail::file_type const path_type = detail::file_probe::type(path);
+
+        if (path_type == detail::file_type::directory)
+            return;
+
+        int const error = detail::file_probe::reserve(path, bytes);
+
+        // A file that was created to reserve the space is removed if no space was reserved.
+        if (error != 0 && path_type == detail::file_type::not_found)
+        {
+            std::error_code ignored{};
+            std::filesystem::remove(path, ignored);
+        }
+
+        if (error != 0 && error != EOPNOTSUPP)
+        {
+            throw validation_error{"Cannot reserve " + to_size_string(bytes) + " for \"" + path.string()
+                                   + "\": " + std::system_category().message(error) + "!"};
+        }
+    }
+
+    //!\brief Returns `bytes` as a string, e.g. `1610612736 bytes (1.5 GiB)`.
+    static std::string to_size_string(uint64_t const bytes)
+    {
+        std::string result = std::to_string(bytes) + (bytes == 1u ? " byte" : " bytes");
+        constexpr std::array<char const *, 6> units{"KiB", "MiB", "GiB", "TiB", "PiB", "EiB"};
+        size_t unit{0u};
+
+        // Integer arithmetic does not depend on the locale; tenths are rounded down.
+        for (uint64_t scaled = bytes >> 10; scaled >= 1024u && unit + 1u < units.size(); scaled >>= 10)
+            ++unit;
+
+        if (bytes >= 1024u)
+        {
+            uint64_t const divisor = uint64_t{1u} << (10u * (unit + 1u));
+            uint64_t const tenths = (bytes % divisor) * 10u / divisor;
+            result += " (" + std::to_string(bytes / divisor) + "." + std::to_string(tenths) + " " + units[unit] + ")";
+        }
+
+        return result;
+    }
+};
+
+/*!\brief A validator that checks if a matches a regular expression pattern.
+ * \ingroup validators
+ * \implements sharg::validator
+ *
+ * \details
+ *
+ * On construction, the validator must receive a pattern for a regular expression.
+ * The validator will check whether the command line argument matches the pattern as std::regex_match would.
+ * Note: A regex_match will only return true if the strings matches the pattern
+ * completely (in contrast to regex_search which also matches substrings).
+ *
+ * The pattern is compiled once on construction into a deterministic finite automaton, which checks a value
+ * in linear time (see sharg::detail::regex_compiler for the supported syntax). Patterns that use other features of
+ * the ECMAScript grammar, e.g. back-references, are compiled into a std::regex instead.
+ * If the pattern is known at compile time, consider using sharg::static_regex_validator.
  *
  * The class than acts as a functor, that throws a sharg::validation_error
  * exception whenever string does not match the pattern.
@@ -978,14 +1844,21 @@ public:
     //!\brief Type of values that are tested by validator.
     using option_value_type = std::string;
 
+    //!\brief Matching takes time linear in the length of the value.
+    static constexpr validator_cost cost{validator_cost::cpu};
+
     /*!\brief Constructing from a vector.
      * \param[in] pattern_ The pattern to match.
+     * \throws std::regex_error if the pattern is not a valid regular expression.
      *
      * \details
      * \stableapi{Since version 1.0.}
      */
-    regex_validator(std::string const & pattern_) : pattern{pattern_}
-    {}
+    regex_validator(std::string const & pattern_) : pattern{pattern_}, dfa{detail::regex_compiler{pattern}.compile()}
+    {
+        if (dfa.status != detail::regex_status::ok)
+            fallback.emplace(pattern);
+    }
 
     /*!\brief Tests whether cmp lies inside values.
      * \param[in] cmp The value to validate.
@@ -996,8 +1869,9 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        std::regex rgx(pattern);
-        if (!std::regex_match(cmp, rgx))
+        bool const is_match = fallback.has_value() ? std::regex_match(cmp, *fallback) : dfa.match(cmp);
+
+        if (!is_match)
             throw validation_error{"Value " + cmp + " did not match the pattern " + pattern + "."};
     }
 
@@ -1034,6 +1908,79 @@ public:
 private:
     //!\brief The pattern to match.
     std::string pattern;
+    //!\brief The compiled pattern.
+    detail::regex_dfa dfa;
+    //!\brief The std::regex that is used if the pattern cannot be compiled into a detail::regex_dfa.
+    std::optional<std::regex> fallback{};
+};
+
+/*!\brief A validator that checks if a matches a regular expression pattern that is known at compile time.
+ * \ingroup validators
+ * \implements sharg::validator
+ * \tparam pattern The pattern to match; a string literal.
+ *
+ * \details
+ *
+ * Behaves like sharg::regex_validator, but the pattern is compiled into a deterministic finite automaton at compile
+ * time. Hence, construction is free and the pattern is checked by the compiler: Invalid patterns and patterns
+ * using unsupported features, e.g. back-references or assertions, are compile errors.
+ * See sharg::detail::regex_compiler for the supported syntax.
+ *
+ * \include test/snippet/static_regex_validator.cpp
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <detail::fixed_string pattern>
+class static_regex_validator
+{
+public:
+    //!\brief Type of values that are tested by validator.
+    using option_value_type = std::string;
+
+    //!\brief Matching takes time linear in the length of the value.
+    static constexpr validator_cost cost{validator_cost::cpu};
+
+    /*!\brief Tests whether cmp matches the pattern.
+     * \param[in] cmp The value to validate.
+     * \throws sharg::validation_error
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    void operator()(option_value_type const & cmp) const
+    {
+        if (!detail::static_regex<pattern>::match(cmp))
+            throw validation_error{"Value " + cmp + " did not match the pattern " + std::string{pattern.view()} + "."};
+    }
+
+    /*!\brief Tests whether every entry in list v matches the pattern.
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range and the value type must
+     *                    be convertible to std::string.
+     * \param  v          The input range to iterate over and check every element.
+     * \throws sharg::validation_error
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    template <std::ranges::forward_range range_type>
+        requires std::convertible_to<std::ranges::range_reference_t<range_type>, std::string const &>
+    void operator()(range_type const & v) const
+    {
+        for (auto && entry : v)
+            (*this)(static_cast<std::string const &>(entry));
+    }
+
+    /*!\brief Returns a message that can be appended to the (positional) options help page info.
+     *
+     * \details
+     * \experimentalapi{Experimental since version 1.1.2.}
+     */
+    std::string get_help_page_message() const
+    {
+        return "Value must match the pattern '" + std::string{pattern.view()} + "'.";
+    }
 };
 
 namespace detail
@@ -1055,6 +2002,9 @@ struct default_validator
     //!\brief Dummy type needed to model sharg::validator but any type is accepted in the `operator()`.
     using option_value_type = std::any;
 
+    //!\brief Nothing is validated.
+    static constexpr validator_cost cost{validator_cost::cheap};
+
     //!\brief Value cmp always passes validation for any type and never throws.
     template <typename option_value_t>
     void operator()(option_value_t const & /*cmp*/) const noexcept
@@ -1067,6 +2017,23 @@ struct default_validator
     }
 };
 
+/*!\brief Calls `validator(value)` if the validator has the cost `cost`.
+ * \ingroup validators
+ * \details
+ * Conjunctions of validators created by sharg::all_of are not called as a whole. Instead, their validators with the
+ * cost `cost` are called. Hence, calling this function for each cost in increasing order calls all validators of
+ * nested conjunctions ordered by cost and, for equal costs, in the order they were given. Validators chained via
+ * sharg::operator|() are called as a whole, i.e. from left to right.
+ */
+template <validator_cost cost, typename validator_type, typename value_type>
+void validate_with_cost(validator_type const & validator, value_type const & value)
+{
+    if constexpr (requires { validator.template validate_with_cost<cost>(value); })
+        validator.template validate_with_cost<cost>(value);
+    else if constexpr (validator_cost_v<validator_type> == cost)
+        validator(value);
+}
+
 /*!\brief A helper struct to chain validators recursively via the pipe operator.
  *\ingroup validators
  *\implements sharg::validator
@@ -1089,6 +2056,9 @@ public:
     using option_value_type =
         std::common_type_t<typename validator1_type::option_value_type, typename validator2_type::option_value_type>;
 
+    //!\brief The cost of the more expensive validator.
+    static constexpr validator_cost cost{std::max(validator_cost_v<validator1_type>, validator_cost_v<validator2_type>)};
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -1140,6 +2110,188 @@ private:
     validator2_type vali2;
 };
 
+/*!\brief A validator that accepts a value if all of its validators accept it, see sharg::all_of.
+ * \ingroup validators
+ * \implements sharg::validator
+ */
+template <validator... validator_types>
+    requires (sizeof...(validator_types) > 0u)
+          && requires { typename std::common_type_t<typename validator_types::option_value_type...>; }
+class validator_all_of_adaptor
+{
+public:
+    //!\brief The underlying type in all validators.
+    using option_value_type = std::common_type_t<typename validator_types::option_value_type...>;
+
+    //!\brief The cost of the most expensive validator.
+    static constexpr validator_cost cost{std::max({validator_cost_v<validator_types>...})};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    validator_all_of_adaptor() = delete;                                              //!< Deleted.
+    validator_all_of_adaptor(validator_all_of_adaptor const &) = default;             //!< Defaulted.
+    validator_all_of_adaptor & operator=(validator_all_of_adaptor const &) = default; //!< Defaulted.
+    validator_all_of_adaptor(validator_all_of_adaptor &&) = default;                  //!< Defaulted.
+    validator_all_of_adaptor & operator=(validator_all_of_adaptor &&) = default;      //!< Defaulted.
+    ~validator_all_of_adaptor() = default;                                            //!< Defaulted.
+
+    //!\brief Constructing from the validators.
+    explicit validator_all_of_adaptor(validator_types... validators_) : validators{std::move(validators_)...}
+    {}
+    //!\}
+
+    /*!\brief Calls the validators ordered by their cost.
+     * \throws The exception of the first validator that does not accept `cmp`.
+     */
+    template <typename cmp_type>
+        requires (std::invocable<validator_types, cmp_type const> && ...)
+    void operator()(cmp_type const & cmp) const
+    {
+        validate_with_cost<validator_cost::cheap>(cmp);
+        validate_with_cost<validator_cost::cpu>(cmp);
+        validate_with_cost<validator_cost::io>(cmp);
+    }
+
+    //!\brief Calls the validators with the cost `cost_`, see sharg::detail::validate_with_cost.
+    template <validator_cost cost_, typename cmp_type>
+    void validate_with_cost(cmp_type const & cmp) const
+    {
+        std::apply(
+            [&cmp](auto const &... validator)
+            {
+                (detail::validate_with_cost<cost_>(validator, cmp), ...);
+            },
+            validators);
+    }
+
+    //!\brief Returns the help page messages of the validators.
+    std::string get_help_page_message() const
+    {
+        return std::apply(
+            [](auto const & first, auto const &... validator)
+            {
+                return (first.get_help_page_message() + ... + (" " + validator.get_help_page_message()));
+            },
+            validators);
+    }
+
+private:
+    //!\brief The validators.
+    std::tuple<validator_types...> validators;
+};
+
+/*!\brief A validator that accepts a value if any of its validators accepts it, see sharg::any_of.
+ * \ingroup validators
+ * \implements sharg::validator
+ */
+template <validator... validator_types>
+    requires (sizeof...(validator_types) > 0u)
+          && requires { typename std::common_type_t<typename validator_types::option_value_type...>; }
+class validator_any_of_adaptor
+{
+public:
+    //!\brief The underlying type in all validators.
+    using option_value_type = std::common_type_t<typename validator_types::option_value_type...>;
+
+    //!\brief The cost of the most expensive validator, which is called if no other validator accepts the value.
+    static constexpr validator_cost cost{std::max({validator_cost_v<validator_types>...})};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    validator_any_of_adaptor() = delete;                                              //!< Deleted.
+    validator_any_of_adaptor(validator_any_of_adaptor const &) = default;             //!< Defaulted.
+    validator_any_of_adaptor & operator=(validator_any_of_adaptor const &) = default; //!< Defaulted.
+    validator_any_of_adaptor(validator_any_of_adaptor &&) = default;                  //!< Defaulted.
+    validator_any_of_adaptor & operator=(validator_any_of_adaptor &&) = default;      //!< Defaulted.
+    ~validator_any_of_adaptor() = default;                                            //!< Defaulted.
+
+    //!\brief Constructing from the validators.
+    explicit validator_any_of_adaptor(validator_types... validators_) : validators{std::move(validators_)...}
+    {}
+    //!\}
+
+    /*!\brief Calls the validators ordered by their cost until one accepts `cmp`.
+     * \throws sharg::validation_error if no validator accepts `cmp`; the message lists the errors of all validators
+     *         in the order they were given.
+     * \throws sharg::validation_timeout if a validator timed out.
+     */
+    template <typename cmp_type>
+        requires (std::invocable<validator_types, cmp_type const> && ...)
+    void operator()(cmp_type const & cmp) const
+    {
+        std::array<std::string, sizeof...(validator_types)> errors{};
+        constexpr auto indices = std::index_sequence_for<validator_types...>{};
+
+        if (accepts<validator_cost::cheap>(cmp, errors, indices) || accepts<validator_cost::cpu>(cmp, errors, indices)
+            || accepts<validator_cost::io>(cmp, errors, indices))
+        {
+            return;
+        }
+
+        std::string message{"None of the alternatives accepts the value:"};
+        for (size_t i = 0; i < errors.size(); ++i)
+            message += " (" + std::to_string(i + 1u) + ") " + errors[i];
+
+        throw validation_error{message};
+    }
+
+    //!\brief Returns the help page messages of the validators.
+    std::string get_help_page_message() const
+    {
+        std::string message{"One of the following must hold:"};
+        size_t i{};
+
+        std::apply(
+            [&](auto const &... validator)
+            {
+                ((message += " (" + std::to_string(++i) + ") " + validator.get_help_page_message()), ...);
+            },
+            validators);
+
+        return message;
+    }
+
+private:
+    //!\brief The validators.
+    std::tuple<validator_types...> validators;
+
+    //!\brief Whether a validator with the cost `cost_` accepts `cmp`; stores the errors of the others.
+    template <validator_cost cost_, typename cmp_type, size_t... index>
+    bool accepts(cmp_type const & cmp,
+                 std::array<std::string, sizeof...(validator_types)> & errors,
+                 std::index_sequence<index...>) const
+    {
+        auto accepted_by = [&]<size_t i>(std::integral_constant<size_t, i>)
+        {
+            if constexpr (validator_cost_v<std::tuple_element_t<i, std::tuple<validator_types...>>> != cost_)
+            {
+                return false;
+            }
+            else
+            {
+                try
+                {
+                    std::get<i>(validators)(cmp);
+                    return true;
+                }
+                catch (validation_timeout const &)
+                {
+                    throw;
+                }
+                catch (validation_error const & error)
+                {
+                    errors[i] = error.what();
+                    return false;
+                }
+            }
+        };
+
+        return (accepted_by(std::integral_constant<size_t, index>{}) || ...);
+    }
+};
+
 } // namespace detail
 
 /*!\brief Enables the chaining of validators.
@@ -1167,7 +2319,8 @@ private:
  * \include test/snippet/validators_chaining.cpp
  *
  * You can chain as many validators as you want which will be evaluated one after
- * the other from left to right (first to last).
+ * the other from left to right (first to last). To call the validators ordered by their cost instead,
+ * use sharg::all_of.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
@@ -1181,4 +2334,54 @@ auto operator|(validator1_type && vali1, validator2_type && vali2)
     return detail::validator_chain_adaptor{std::forward<validator1_type>(vali1), std::forward<validator2_type>(vali2)};
 }
 
+/*!\brief A validator that accepts a value if all `validators` accept it.
+ * \ingroup validators
+ * \param[in] validators The validators; their option value types must have a common type.
+ * \returns A validator modelling sharg::validator.
+ *
+ * \details
+ *
+ * Like chaining the validators via sharg::operator|(), but the validators are called ordered by their cost
+ * (see sharg::validator_cost_v) and, for equal costs, in the given order. The error of the first validator that
+ * rejects the value is thrown. For example, a sharg::regex_validator is called before a sharg::input_file_validator,
+ * such that a value that does not match the pattern is rejected without accessing the file system. Validators that
+ * are chained via sharg::operator|() are called as a whole, in the position of their most expensive validator.
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <validator... validator_types>
+    requires (sizeof...(validator_types) > 0u)
+auto all_of(validator_types &&... validators)
+{
+    return detail::validator_all_of_adaptor<std::remove_cvref_t<validator_types>...>{
+        std::forward<validator_types>(validators)...};
+}
+
+/*!\brief A validator that accepts a value if any of the `validators` accepts it.
+ * \ingroup validators
+ * \param[in] validators The validators; their option value types must have a common type.
+ * \returns A validator modelling sharg::validator.
+ *
+ * \details
+ *
+ * The validators are called ordered by their cost (see sharg::validator_cost_v) and, for equal costs, in the given
+ * order until one accepts the value. Hence, several cheap alternatives are tried before any validator accesses the
+ * file system. If no validator accepts the value, a sharg::validation_error listing the errors of all validators
+ * in the given order is thrown.
+ *
+ * ```cpp
+ * // Either a number of threads or "auto".
+ * auto threads_validator = sharg::any_of(sharg::static_regex_validator<"auto">{}, sharg::regex_validator{"[0-9]+"});
+ * ```
+ *
+ * \experimentalapi{Experimental since version 1.1.2.}
+ */
+template <validator... validator_types>
+    requires (sizeof...(validator_types) > 0u)
+auto any_of(validator_types &&... validators)
+{
+    return detail::validator_any_of_adaptor<std::remove_cvref_t<validator_types>...>{
+        std::forward<validator_types>(validators)...};
+}
+
 } // namespace sharg
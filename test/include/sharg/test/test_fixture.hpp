@@ -87,6 +87,16 @@ protected:
         return testing::internal::GetCapturedStdout();
     }
 
+    //!\brief Expects that `statement` exits via std::exit with `exit_code` and prints a match of `regex` to stderr.
+    template <typename statement_t>
+    static void expect_exit(statement_t && statement, int const exit_code, std::string const & regex)
+    {
+        // See get_parse_cout_on_exit.
+        toggle_guardian();
+        EXPECT_EXIT(statement(), ::testing::ExitedWithCode(exit_code), regex);
+        toggle_guardian();
+    }
+
     static inline std::string basic_options_str = "  Common options\n"
                                                   "    -h, --help\n"
                                                   "          Prints the help page.\n"
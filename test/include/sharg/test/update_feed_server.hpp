@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \brief Provides sharg::test::update_feed_server.
+ */
+
+#pragma once
+
+#if !defined(_WIN32)
+#    include <poll.h>
+#    include <unistd.h>
+
+#    include <sys/socket.h>
+#    include <sys/un.h>
+
+#    include <atomic>
+#    include <cstring>
+#    include <filesystem>
+#    include <mutex>
+#    include <stdexcept>
+#    include <string>
+#    include <thread>
+
+namespace sharg::test
+{
+
+/*!\brief A stand-in for the update server that answers HTTP requests on a unix domain socket.
+ * \details
+ * Every `GET` request is answered with the same body. Use `url()` as sharg::parser::set_update_feed.
+ */
+class update_feed_server
+{
+public:
+    update_feed_server(update_feed_server const &) = delete;
+    update_feed_server & operator=(update_feed_server const &) = delete;
+
+    //!\brief Listens on `socket_path` and answers each request with `body`.
+    update_feed_server(std::filesystem::path socket_path, std::string body) :
+        path{std::move(socket_path)},
+        response{"HTTP/1.0 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body}
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::string const native_path = path.string();
+
+        if (native_path.size() >= sizeof(address.sun_path))
+            throw std::runtime_error{"The socket path is too long: " + native_path};
+
+        std::memcpy(address.sun_path, native_path.data(), native_path.size());
+        listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (listener == -1 || ::bind(listener, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0
+            || ::listen(listener, 64) != 0)
+        {
+            throw std::runtime_error{"Cannot listen on " + native_path};
+        }
+
+        thread = std::jthread{[this]()
+                              {
+                                  serve();
+                              }};
+    }
+
+    ~update_feed_server()
+    {
+        stop = true;
+        thread = {}; // Joins the thread.
+        ::close(listener);
+        std::filesystem::remove(path);
+    }
+
+    //!\brief The URL of the feed.
+    std::string url() const
+    {
+        return "unix://" + path.string();
+    }
+
+    //!\brief The number of answered requests.
+    size_t request_count() const
+    {
+        return count;
+    }
+
+    //!\brief The target of the last request, e.g. `/SeqAn-Sharg_Linux_64_app_1.0.0`.
+    std::string last_target() const
+    {
+        std::lock_guard lock{mutex};
+        return target;
+    }
+
+private:
+    std::filesystem::path path{};
+    std::string response{};
+    int listener{-1};
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> count{0u};
+    mutable std::mutex mutex{};
+    std::string target{};
+    std::jthread thread{};
+
+    void serve()
+    {
+        pollfd poll_listener{.fd = listener, .events = POLLIN, .revents = 0};
+
+        while (!stop)
+        {
+            if (::poll(&poll_listener, 1, 10) <= 0)
+                continue;
+
+            int const connection = ::accept(listener, nullptr, nullptr);
+
+            if (connection == -1)
+                continue;
+
+            answer(connection);
+            ::close(connection);
+        }
+    }
+
+    void answer(int const connection)
+    {
+        std::string request{};
+        char buffer[1024];
+
+        while (request.find("\r\n\r\n") == std::string::npos)
+        {
+            ssize_t const received = ::recv(connection, buffer, sizeof(buffer), 0);
+
+            if (received <= 0)
+                return;
+
+            request.append(buffer, received);
+        }
+
+        // The request line is, e.g., "GET /SeqAn-Sharg_Linux_64_app_1.0.0 HTTP/1.0".
+        size_t const target_end = request.find(' ', 4u);
+        {
+            std::lock_guard lock{mutex};
+            target = request.substr(4u, target_end - 4u);
+        }
+
+        for (size_t sent = 0; sent < response.size();)
+        {
+            ssize_t const written = ::send(connection, response.data() + sent, response.size() - sent, 0);
+
+            if (written <= 0)
+                return;
+
+            sent += written;
+        }
+
+        ++count;
+    }
+};
+
+} // namespace sharg::test
+#endif
@@ -0,0 +1,355 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <sharg/parser.hpp>
+
+namespace bench
+{
+
+enum class map_level
+{
+    low,
+    medium,
+    high
+};
+
+auto enumeration_names(map_level)
+{
+    return std::unordered_map<std::string_view, map_level>{{"low", map_level::low},
+                                                           {"medium", map_level::medium},
+                                                           {"high", map_level::high}};
+}
+
+enum class table_level
+{
+    low,
+    medium,
+    high
+};
+
+constexpr auto enumeration_names(table_level)
+{
+    return sharg::enumeration_table<table_level, 3>{
+        {{"low", table_level::low}, {"medium", table_level::medium}, {"high", table_level::high}}};
+}
+
+} // namespace bench
+
+// Simulates a shell glob that expands to many file names, e.g. `./app *.fastq`.
+static std::vector<std::string> generate_file_names(size_t const count)
+{
+    std::vector<std::string> file_names{"./app"};
+    file_names.reserve(count + 1u);
+
+    for (size_t i = 0; i < count; ++i)
+        file_names.push_back("sample_" + std::to_string(i) + ".fastq");
+
+    return file_names;
+}
+
+template <typename value_t>
+static void positional_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::vector<std::string> const file_names = generate_file_names(count);
+    std::vector<char const *> argv(file_names.size());
+    std::ranges::transform(file_names,
+                           argv.begin(),
+                           [](std::string const & str)
+                           {
+                               return str.c_str();
+                           });
+
+    std::vector<value_t> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.add_positional_option(values, sharg::config{});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    if (values.size() != count)
+        state.SkipWithError("Not all positional arguments were parsed.");
+
+    state.SetComplexityN(count);
+    state.counters["args/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Same as positional_list, but the file names are read from a response file, e.g. `./app @files.txt`.
+static void response_file_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::vector<std::string> const file_names = generate_file_names(count);
+    std::filesystem::path const response_file = std::filesystem::temp_directory_path() / "sharg_benchmark_args.txt";
+
+    {
+        std::ofstream stream{response_file};
+        for (size_t i = 1; i < file_names.size(); ++i)
+            stream << file_names[i] << '\n';
+    }
+
+    std::string const response_argument{"@" + response_file.string()};
+    std::array<char const *, 2> const argv{"./app", response_argument.c_str()};
+    std::vector<std::string> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.enable_response_files();
+        parser.add_positional_option(values, sharg::config{});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    std::filesystem::remove(response_file);
+
+    if (values.size() != count)
+        state.SkipWithError("Not all positional arguments were parsed.");
+
+    state.counters["args/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Parses a list of named enumeration values, e.g. `./app low high medium ...`.
+template <typename enum_t>
+static void enum_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::array<char const *, 3> const names{"low", "medium", "high"};
+    std::vector<char const *> argv{"./app"};
+
+    for (size_t i = 0; i < count; ++i)
+        argv.push_back(names[i % names.size()]);
+
+    std::vector<enum_t> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.add_positional_option(values, sharg::config{});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.counters["args/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Parses a list of weights, either as `-w 0.5 -w 0.25 ...` or as `-w 0.5,0.25,...` (state.range(1) != 0).
+static void option_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    bool const separated = state.range(1) != 0;
+    std::vector<std::string> arguments{"./app"};
+    std::string joined{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string const weight = std::to_string(1.0 / static_cast<double>(i + 1u));
+
+        if (separated)
+        {
+            joined += (i == 0u ? "" : ",") + weight;
+        }
+        else
+        {
+            arguments.push_back("-w");
+            arguments.push_back(weight);
+        }
+    }
+
+    if (separated)
+    {
+        arguments.push_back("-w");
+        arguments.push_back(joined);
+    }
+
+    std::vector<char const *> argv(arguments.size());
+    std::ranges::transform(arguments,
+                           argv.begin(),
+                           [](std::string const & str)
+                           {
+                               return str.c_str();
+                           });
+
+    std::vector<double> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.add_option(values,
+                          sharg::config{.short_id = 'w',
+                                        .list_separator = separated ? ',' : '\0',
+                                        .validator = sharg::arithmetic_range_validator{0, 1}});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    if (values.size() != count)
+        state.SkipWithError("Not all values were parsed.");
+
+    state.counters["values/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Validates state.range(0) existing input files on local disk (state.range(1) == 0) or tmpfs (state.range(1) == 1).
+// The files are probed with io_uring if state.range(2) == 1 and validated concurrently otherwise.
+static void input_file_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::filesystem::path const root = state.range(1) ? "/dev/shm" : std::filesystem::temp_directory_path();
+
+    if (!std::filesystem::is_directory(root))
+    {
+        state.SkipWithError("The directory /dev/shm does not exist.");
+        return;
+    }
+
+    bool const use_io_uring = state.range(2);
+
+    if (use_io_uring && !sharg::detail::file_probe::batch{std::vector<std::filesystem::path>{root}}.is_complete())
+    {
+        state.SkipWithError("io_uring is not available.");
+        return;
+    }
+
+    std::filesystem::path const directory = root / "sharg_benchmark_files";
+    std::filesystem::create_directories(directory);
+    std::vector<std::string> arguments{"./app"};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        arguments.push_back((directory / ("sample_" + std::to_string(i) + ".fastq")).string());
+        std::ofstream{arguments.back()};
+    }
+
+    std::vector<char const *> argv(arguments.size());
+    std::ranges::transform(arguments,
+                           argv.begin(),
+                           [](std::string const & str)
+                           {
+                               return str.c_str();
+                           });
+
+    std::vector<std::filesystem::path> values{};
+    sharg::input_file_validator validator{{"fq", "fastq"}};
+    validator.use_io_uring(use_io_uring);
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.add_positional_option(values, sharg::config{.validator = validator});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    std::filesystem::remove_all(directory);
+    state.counters["files/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Validates a list of contig names against a list of state.range(1) valid contig names.
+static void value_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    size_t const valid_count = state.range(1);
+    std::vector<std::string> valid_values{};
+    std::vector<std::string> arguments{"./app"};
+
+    for (size_t i = 0; i < valid_count; ++i)
+        valid_values.push_back("contig_" + std::to_string(i));
+
+    for (size_t i = 0; i < count; ++i)
+        arguments.push_back(valid_values[(i * 7919u) % valid_count]);
+
+    std::vector<char const *> argv(arguments.size());
+    std::ranges::transform(arguments,
+                           argv.begin(),
+                           [](std::string const & str)
+                           {
+                               return str.c_str();
+                           });
+
+    sharg::value_list_validator const validator{valid_values};
+    std::vector<std::string> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        parser.add_positional_option(values, sharg::config{.validator = validator});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.counters["args/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Validates a list of file names against the pattern `sample_[0-9]+\.fastq`.
+template <typename validator_t>
+static void regex_list(benchmark::State & state)
+{
+    size_t const count = state.range(0);
+    std::vector<std::string> const file_names = generate_file_names(count);
+    std::vector<char const *> argv(file_names.size());
+    std::ranges::transform(file_names,
+                           argv.begin(),
+                           [](std::string const & str)
+                           {
+                               return str.c_str();
+                           });
+
+    std::vector<std::string> values{};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"app", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        validator_t validator{};
+        parser.add_positional_option(values, sharg::config{.validator = validator});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.counters["args/s"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+namespace bench
+{
+
+struct runtime_regex_validator : sharg::regex_validator
+{
+    runtime_regex_validator() : sharg::regex_validator{"sample_[0-9]+\\.fastq"}
+    {}
+};
+
+using static_regex_validator = sharg::static_regex_validator<"sample_[0-9]+\\.fastq">;
+
+} // namespace bench
+
+BENCHMARK_TEMPLATE(positional_list, std::string)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity();
+BENCHMARK_TEMPLATE(positional_list, std::filesystem::path)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000)
+    ->Complexity();
+
+BENCHMARK(response_file_list)->Arg(100'000);
+
+BENCHMARK_TEMPLATE(enum_list, bench::map_level)->Arg(10'000);
+BENCHMARK_TEMPLATE(enum_list, bench::table_level)->Arg(10'000);
+
+BENCHMARK(option_list)->ArgsProduct({{1'000, 10'000}, {0, 1}});
+
+BENCHMARK(input_file_list)
+    ->ArgsProduct({{100'000}, {0, 1}, {0, 1}})
+    ->ArgNames({"files", "tmpfs", "io_uring"})
+    ->UseRealTime();
+
+BENCHMARK(value_list)->ArgsProduct({{1'000}, {10, 100'000}});
+
+BENCHMARK_TEMPLATE(regex_list, bench::runtime_regex_validator)->Arg(10'000);
+BENCHMARK_TEMPLATE(regex_list, bench::static_regex_validator)->Arg(10'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <sstream>
+
+#include <sharg/parser.hpp>
+
+// A tool with many options of different types, each with a default value and a description.
+struct options
+{
+    std::vector<int32_t> integers{};
+    std::vector<double> doubles{};
+    std::vector<std::string> strings{};
+
+    explicit options(size_t const count) : integers(count), doubles(count), strings(count, "default")
+    {}
+
+    void add_to(sharg::parser & parser)
+    {
+        std::string const description{"The value of this option influences the result of the computation in a way "
+                                      "that needs a description of a few lines on the help page."};
+
+        for (size_t i = 0; i < integers.size(); ++i)
+        {
+            std::string const suffix = std::to_string(i);
+            doubles[i] = 0.25 * i;
+
+            parser.add_option(integers[i],
+                              sharg::config{.long_id = "integer-" + suffix,
+                                            .description = description,
+                                            .validator = sharg::arithmetic_range_validator{0, 1000}});
+            parser.add_option(doubles[i], sharg::config{.long_id = "double-" + suffix, .description = description});
+            parser.add_option(strings[i], sharg::config{.long_id = "string-" + suffix, .description = description});
+        }
+    }
+};
+
+// Prints the help page with options of `state.range(0)` * 3 options to a std::ostringstream (0) or std::cout (1).
+static void help_page(benchmark::State & state)
+{
+    options values{static_cast<size_t>(state.range(0))};
+    sharg::parser parser{"app", {}, sharg::update_notifications::off};
+    parser.info.short_description = "A tool with many options.";
+    values.add_to(parser);
+
+    std::array<std::string_view, 2> const arguments{"./app", "-h"};
+    bool const to_cout = state.range(1);
+
+    // The page is written to the standard output, which is redirected to /dev/null during the benchmark.
+    std::cout.flush();
+    int const standard_output = ::dup(STDOUT_FILENO);
+    int const null_device = ::open("/dev/null", O_WRONLY);
+    ::dup2(null_device, STDOUT_FILENO);
+
+    size_t bytes{};
+    for (auto _ : state)
+    {
+        if (to_cout)
+        {
+            benchmark::DoNotOptimize(parser.parse(arguments, std::cout));
+        }
+        else
+        {
+            std::ostringstream stream{};
+            benchmark::DoNotOptimize(parser.parse(arguments, stream));
+            bytes += stream.view().size();
+        }
+    }
+
+    std::cout.flush();
+    ::dup2(standard_output, STDOUT_FILENO);
+    ::close(null_device);
+    ::close(standard_output);
+
+    if (bytes != 0u)
+        state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(help_page)->ArgsProduct({{10, 100}, {0, 1}})->ArgNames({"options", "cout"});
+
+BENCHMARK_MAIN();
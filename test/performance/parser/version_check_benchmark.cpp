@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <filesystem>
+
+#include <sharg/detail/version_check.hpp>
+#include <sharg/test/tmp_filename.hpp>
+#include <sharg/test/update_feed_server.hpp>
+
+// The detection of a downloader before Sharg 1.1.2: one shell per candidate.
+static void detect_via_system(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        bool found = !system("/usr/bin/env -i wget --version > /dev/null 2>&1")
+                  || !system("/usr/bin/env -i curl --version > /dev/null 2>&1");
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+// Searches the directories in PATH. The second argument enables the cache.
+static void detect_in_process(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp{"cache"};
+    std::filesystem::path const cache_directory = state.range(0) ? tmp.get_path().parent_path() : "";
+
+    for (auto _ : state)
+    {
+        sharg::detail::downloader found = sharg::detail::version_checker::find_downloader(cache_directory);
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+// Runs `true` via a shell, as the server call did before Sharg 1.1.2.
+static void launch_via_system(benchmark::State & state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(system("/usr/bin/env -i /usr/bin/true > /dev/null 2>&1"));
+}
+
+// Runs `true` via posix_spawn.
+static void launch_via_spawn(benchmark::State & state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(sharg::detail::run_program({"/usr/bin/true"}));
+}
+
+// Runs the complete version check against a local feed: a function (0) or a server on a unix domain socket (1).
+static void version_check(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp{"feed"};
+    std::filesystem::path const directory = tmp.get_path().parent_path();
+    setenv(sharg::detail::version_checker::home_env_name, directory.c_str(), 1);
+
+    // The versions are not newer, i.e. no message is printed.
+    std::string const versions{"1.0.0\n0.0.1\n"};
+    sharg::test::update_feed_server const server{directory / "feed.sock", versions};
+    sharg::detail::version_checker checker{"bench", "1.0.0"};
+
+    if (state.range(0) == 0)
+    {
+        checker.feed = sharg::detail::update_feed{[&versions](std::string const &) -> std::optional<std::string>
+                                                  {
+                                                      return versions;
+                                                  }};
+    }
+    else
+    {
+        checker.feed = sharg::detail::update_feed{server.url()};
+    }
+
+    for (auto _ : state)
+    {
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        checker(std::move(prom));
+        benchmark::DoNotOptimize(future.get());
+    }
+}
+
+BENCHMARK(detect_via_system)->UseRealTime();
+BENCHMARK(detect_in_process)->Arg(0)->Arg(1)->ArgName("cached")->UseRealTime();
+BENCHMARK(launch_via_system)->UseRealTime();
+BENCHMARK(launch_via_spawn)->UseRealTime();
+BENCHMARK(version_check)->Arg(0)->Arg(1)->ArgName("socket")->UseRealTime();
+
+BENCHMARK_MAIN();
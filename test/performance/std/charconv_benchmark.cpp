@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <bit>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sharg/std/charconv>
+
+enum class input_kind : int64_t
+{
+    weight,     // e.g. 0.734215
+    round_trip, // shortest round trip representation, e.g. 0.30000000000000004
+    scientific  // e.g. 3.1e-12
+};
+
+template <typename value_t>
+static std::vector<std::string> generate_input(input_kind const kind)
+{
+    std::mt19937_64 rng{42u};
+    std::vector<std::string> input(10'000u);
+    char buffer[64];
+
+    for (std::string & str : input)
+    {
+        switch (kind)
+        {
+            case input_kind::weight:
+                std::snprintf(buffer, sizeof(buffer), "%.6f", std::uniform_real_distribution<double>{0, 1}(rng));
+                break;
+            case input_kind::round_trip:
+                std::snprintf(buffer,
+                              sizeof(buffer),
+                              "%.*g",
+                              std::numeric_limits<value_t>::max_digits10,
+                              static_cast<double>(std::uniform_real_distribution<value_t>{0, 1}(rng)));
+                break;
+            case input_kind::scientific:
+                std::snprintf(buffer,
+                              sizeof(buffer),
+                              "%.1fe-%d",
+                              std::uniform_real_distribution<double>{1, 10}(rng),
+                              static_cast<int>(rng() % 30u));
+                break;
+        }
+
+        str = buffer;
+    }
+
+    return input;
+}
+
+template <typename value_t, typename parse_t>
+static void run(benchmark::State & state, parse_t && parse)
+{
+    std::vector<std::string> const input = generate_input<value_t>(static_cast<input_kind>(state.range(0)));
+    size_t bytes{};
+    for (std::string const & str : input)
+        bytes += str.size();
+
+    for (auto _ : state)
+    {
+        for (std::string const & str : input)
+        {
+            value_t value{};
+            parse(str, value);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    state.counters["values/s"] = benchmark::Counter(input.size(), benchmark::Counter::kIsIterationInvariantRate);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+template <typename value_t>
+static void strtod(benchmark::State & state)
+{
+    run<value_t>(state,
+                 [](std::string const & str, value_t & value)
+                 {
+                     if constexpr (std::same_as<value_t, float>)
+                         value = std::strtof(str.c_str(), nullptr);
+                     else
+                         value = std::strtod(str.c_str(), nullptr);
+                 });
+}
+
+template <typename value_t>
+static void std_from_chars(benchmark::State & state)
+{
+    run<value_t>(state,
+                 [](std::string const & str, value_t & value)
+                 {
+                     std::from_chars(str.data(), str.data() + str.size(), value);
+                 });
+}
+
+template <typename value_t>
+static void sharg_from_chars_fast(benchmark::State & state)
+{
+    run<value_t>(state,
+                 [](std::string const & str, value_t & value)
+                 {
+                     sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+                 });
+}
+
+// Argument: 0 = weight, 1 = round_trip, 2 = scientific
+BENCHMARK_TEMPLATE(strtod, double)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(std_from_chars, double)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(sharg_from_chars_fast, double)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(strtod, float)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(std_from_chars, float)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(sharg_from_chars_fast, float)->DenseRange(0, 2);
+
+BENCHMARK_MAIN();
@@ -64,6 +64,14 @@ if (NOT TARGET sharg::test::unit)
     add_library (sharg::test::unit ALIAS sharg_test_unit)
 endif ()
 
+# sharg::test::performance specifies required flags, includes and libraries
+# needed for performance test cases in sharg/test/performance
+if (NOT TARGET sharg::test::performance)
+    add_library (sharg_test_performance INTERFACE)
+    target_link_libraries (sharg_test_performance INTERFACE "sharg::test" "benchmark::benchmark")
+    add_library (sharg::test::performance ALIAS sharg_test_performance)
+endif ()
+
 # sharg::test::coverage specifies required flags, includes and libraries
 # needed for coverage test cases in sharg/test/coverage
 if (NOT TARGET sharg::test::coverage)
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <charconv>
+
+#include <sharg/all.hpp>
+
+namespace foo
+{
+
+struct interval
+{
+    int begin{};
+    int end{};
+
+    // Needed to print the default value on the help page.
+    friend std::ostream & operator<<(std::ostream & os, interval const & value)
+    {
+        return os << value.begin << '-' << value.end;
+    }
+};
+
+// Convert an argument like "3-7" into an interval. No stream operator>> is needed.
+interval from_string(interval, std::string_view const str)
+{
+    interval result{};
+    char const * const last = str.data() + str.size();
+    std::from_chars_result res = std::from_chars(str.data(), last, result.begin);
+
+    if (res.ec != std::errc{} || res.ptr == last || *res.ptr != '-')
+        throw std::invalid_argument{"Expected <begin>-<end>."};
+
+    res = std::from_chars(res.ptr + 1, last, result.end);
+
+    if (res.ec != std::errc{} || res.ptr != last)
+        throw std::invalid_argument{"Expected <begin>-<end>."};
+
+    return result;
+}
+
+} // namespace foo
+
+int main(int argc, char const * argv[])
+{
+    foo::interval value{};
+
+    sharg::parser parser{"my_program", argc, argv};
+
+    // Because of the from_string function
+    // you can now add an option that takes a value of type interval:
+    parser.add_option(value,
+                      sharg::config{.short_id = 'i', .long_id = "interval", .description = "Give me an interval."});
+
+    try
+    {
+        parser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+}
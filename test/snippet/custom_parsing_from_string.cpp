@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <complex>
+
+#include <sharg/all.hpp>
+
+namespace sharg::custom
+{
+// Specialise the sharg::custom::parsing data structure to parse std::complex<double> from "<real>,<imag>"
+// instead of the "(<real>,<imag>)" format expected by the stream operator.
+template <>
+struct parsing<std::complex<double>>
+{
+    static std::complex<double> from_string(std::string_view const str)
+    {
+        size_t const comma = str.find(',');
+
+        if (comma == std::string_view::npos)
+            throw sharg::user_input_error{"Expected <real>,<imag> but got " + std::string{str} + "."};
+
+        return {std::stod(std::string{str.substr(0, comma)}), std::stod(std::string{str.substr(comma + 1)})};
+    }
+};
+
+} // namespace sharg::custom
+
+int main(int argc, char const * argv[])
+{
+    std::complex<double> value{};
+
+    sharg::parser parser{"my_program", argc, argv};
+
+    // Because of the parsing struct and
+    // the static member function from_string
+    // the option is parsed via from_string instead of the stream operator:
+    parser.add_option(value,
+                      sharg::config{.short_id = 'c', .long_id = "complex", .description = "Give me a complex number."});
+
+    try
+    {
+        parser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+}
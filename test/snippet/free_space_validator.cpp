@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+int main(int argc, char const ** argv)
+{
+    sharg::parser myparser{"Test", argc, argv}; // initialize
+
+    std::vector<std::filesystem::path> input_files{};
+    std::filesystem::path output_file{};
+
+    // The input files are added first, hence they are parsed before the output file is validated.
+    myparser.add_option(input_files,
+                        sharg::config{.short_id = 'i',
+                                      .description = "The input files.",
+                                      .validator = sharg::input_file_validator{}});
+
+    // The output requires at most twice the size of the input files.
+    auto output_size = [&input_files]()
+    {
+        return 2u * sharg::free_space_validator::size_of(input_files);
+    };
+
+    myparser.add_option(output_file,
+                        sharg::config{.short_id = 'o',
+                                      .description = "The output file.",
+                                      .validator = sharg::output_file_validator{}
+                                                 | sharg::free_space_validator{output_size}});
+
+    try
+    {
+        myparser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+
+    return 0;
+}
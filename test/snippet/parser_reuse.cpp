@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sstream>
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    int threads{1};
+    std::string input{};
+
+    // The parser is set up once ...
+    sharg::parser parser{"my_program", std::vector<std::string>{}, sharg::update_notifications::off};
+    parser.add_option(threads, sharg::config{.short_id = 't', .long_id = "threads"});
+    parser.add_positional_option(input, sharg::config{});
+
+    // ... and parses many command lines, e.g. one for each job in a queue.
+    std::vector<std::vector<std::string_view>> const jobs{{"my_program", "-t", "4", "a.fastq"},
+                                                          {"my_program", "b.fastq"},
+                                                          {"my_program", "--version"},
+                                                          {"my_program", "-t", "four", "c.fastq"}};
+
+    for (auto const & job : jobs)
+    {
+        std::ostringstream help{}; // Help and version information is not printed to std::cout.
+
+        try
+        {
+            if (parser.parse(job, help) == sharg::parse_outcome::parsed)
+                std::cout << "input: " << input << ", threads: " << threads << '\n';
+            else
+                std::cout << "printed: " << help.str().substr(0, help.str().find('\n')) << '\n';
+        }
+        catch (sharg::parser_error const & ext)
+        {
+            std::cout << "[PARSER ERROR] " << ext.what() << '\n';
+        }
+    }
+}
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <fstream>
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    // Usually, the response file is written by a script or workflow manager.
+    std::filesystem::path const response_file{std::filesystem::temp_directory_path() / "sharg_snippet_arguments.txt"};
+    std::ofstream{response_file} << "--threads 4\n"
+                                    "sample_1.fastq 'sample 2.fastq'\n";
+
+    // ./my_program @/tmp/sharg_snippet_arguments.txt sample_3.fastq
+    std::string const response_argument{"@" + response_file.string()};
+    char const * argv[] = {"./my_program", response_argument.c_str(), "sample_3.fastq"};
+
+    int threads{1};
+    std::vector<std::filesystem::path> files{};
+
+    sharg::parser parser{"my_program", 3, argv, sharg::update_notifications::off};
+    parser.enable_response_files(); // GNU syntax by default
+    parser.add_option(threads, sharg::config{.long_id = "threads"});
+    parser.add_positional_option(files, sharg::config{});
+
+    try
+    {
+        parser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+
+    std::filesystem::remove(response_file);
+
+    std::cout << "threads: " << threads << '\n';
+    for (auto const & file : files)
+        std::cout << file << '\n';
+}
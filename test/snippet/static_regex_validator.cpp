@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2006-2024 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+int main(int argc, char const ** argv)
+{
+    sharg::parser myparser{"Test", argc, argv}; // initialize
+
+    std::string my_string;
+    // The pattern is compiled at compile time; an invalid pattern does not compile.
+    sharg::static_regex_validator<"[a-zA-Z]+@[a-zA-Z]+\\.com"> my_validator{};
+
+    myparser.add_option(my_string,
+                        sharg::config{.short_id = 's',
+                                      .long_id = "str",
+                                      .description = "Give me a string.",
+                                      .validator = my_validator});
+
+    try
+    {
+        myparser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+
+    std::cerr << "email address given by user passed validation: " << my_string << "\n";
+    return 0;
+}
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/deadline.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+
+using namespace std::chrono_literals;
+
+// Returns the id of the thread that calls the function.
+static std::thread::id thread_id(std::filesystem::path const &)
+{
+    return std::this_thread::get_id();
+}
+
+TEST(deadline_test, scope)
+{
+    using sharg::detail::deadline;
+
+    EXPECT_EQ(deadline::timeout(), 0ms);
+    {
+        deadline::scope const outer{100ms};
+        EXPECT_EQ(deadline::timeout(), 100ms);
+        {
+            deadline::scope const inner{0ms};
+            EXPECT_EQ(deadline::timeout(), 0ms);
+        }
+        EXPECT_EQ(deadline::timeout(), 100ms);
+    }
+    EXPECT_EQ(deadline::timeout(), 0ms);
+}
+
+TEST(deadline_test, without_timeout)
+{
+    // The function is called directly.
+    EXPECT_EQ(sharg::detail::deadline::run("file", thread_id), std::this_thread::get_id());
+}
+
+TEST(deadline_test, within_timeout)
+{
+    using sharg::detail::deadline;
+
+    deadline::scope const timeout{10s};
+
+    // The function is called on the same worker thread every time.
+    std::thread::id const worker = deadline::run("file", thread_id);
+    EXPECT_NE(worker, std::this_thread::get_id());
+    EXPECT_EQ(deadline::run("file", thread_id), worker);
+
+    EXPECT_EQ(deadline::run("file",
+                            [](std::filesystem::path const & path)
+                            {
+                                return path.string();
+                            }),
+              "file");
+
+    // Exceptions of the function are rethrown.
+    EXPECT_THROW(deadline::run("file",
+                               [](std::filesystem::path const & path)
+                               {
+                                   throw std::filesystem::filesystem_error{"Failure", path, std::error_code{}};
+                               }),
+                 std::filesystem::filesystem_error);
+}
+
+TEST(deadline_test, timeout)
+{
+    using sharg::detail::deadline;
+
+    deadline::scope const timeout{20ms};
+    std::thread::id const worker = deadline::run("file", thread_id);
+
+    auto hang = [](std::filesystem::path const &)
+    {
+        std::this_thread::sleep_for(500ms);
+    };
+
+    EXPECT_THROW_MSG(deadline::run("/mnt/stale/file", hang),
+                     sharg::validation_timeout,
+                     "The file system did not respond within 20 ms while checking \"/mnt/stale/file\"!");
+
+    // The hanging worker is abandoned and a new one is started.
+    std::thread::id const new_worker = deadline::run("file", thread_id);
+    EXPECT_NE(new_worker, worker);
+    EXPECT_NE(new_worker, std::this_thread::get_id());
+}
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <memory>
+#include <thread>
+
+#include <sharg/detail/file_probe.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+struct file_probe_test : public ::testing::Test
+{
+    sharg::test::tmp_filename const tmp{"probe"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::vector<std::filesystem::path> paths{};
+
+    void SetUp() override
+    {
+        std::filesystem::create_directory(directory);
+
+        for (size_t i = 0; i < 600u; ++i)
+        {
+            paths.push_back(directory / ("file_" + std::to_string(i)));
+            std::ofstream{paths.back()};
+        }
+
+        std::filesystem::create_directory(directory / "sub");
+        std::filesystem::create_symlink(directory / "loop", directory / "loop");
+        paths.push_back(directory / "sub");
+        paths.push_back(directory / "missing");
+        paths.push_back(paths[0] / "not_a_directory");
+        paths.push_back(directory / "loop");
+        paths.push_back(paths[0]);
+        paths.push_back("");
+
+        // Unless run as root, the file cannot be read and the type of the file in the directory cannot be determined.
+        std::filesystem::create_directory(directory / "locked");
+        std::ofstream{directory / "locked" / "file"};
+        std::ofstream{directory / "unreadable"};
+        paths.push_back(directory / "locked" / "file");
+        paths.push_back(directory / "unreadable");
+        std::filesystem::permissions(directory / "locked", std::filesystem::perms::none);
+        std::filesystem::permissions(directory / "unreadable", std::filesystem::perms::owner_write);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::permissions(directory / "locked", std::filesystem::perms::owner_all);
+    }
+
+    // Returns the type or the message of the exception.
+    static std::string type_of(std::filesystem::path const & path)
+    {
+        try
+        {
+            return std::to_string(static_cast<int>(sharg::detail::file_probe::type(path)));
+        }
+        catch (std::filesystem::filesystem_error const & error)
+        {
+            return error.what();
+        }
+    }
+};
+
+TEST_F(file_probe_test, batch)
+{
+    using sharg::detail::file_probe;
+    using sharg::detail::file_type;
+
+    std::vector<std::string> expected_types{};
+    std::vector<bool> expected_readability{};
+
+    std::string const regular_type = std::to_string(static_cast<int>(file_type::regular));
+    std::string const directory_type = std::to_string(static_cast<int>(file_type::directory));
+
+    for (std::filesystem::path const & path : paths)
+    {
+        expected_types.push_back(type_of(path));
+
+        if (expected_types.back() == regular_type || expected_types.back() == directory_type)
+            expected_readability.push_back(file_probe::is_readable(path, file_probe::type(path)));
+        else
+            expected_readability.push_back(false);
+    }
+
+    EXPECT_EQ(expected_types[600], directory_type);
+    EXPECT_EQ(expected_types[601], std::to_string(static_cast<int>(file_type::not_found)));
+    EXPECT_EQ(expected_types[602], std::to_string(static_cast<int>(file_type::not_found)));
+#ifndef _WIN32
+    EXPECT_NE(expected_types[603].find("Cannot determine the file type"), std::string::npos);
+#endif
+
+    file_probe::batch const probed{paths};
+    file_probe::reset_syscall_count();
+
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        EXPECT_EQ(type_of(paths[i]), expected_types[i]) << paths[i];
+
+        if (expected_types[i] == regular_type || expected_types[i] == directory_type)
+        {
+            EXPECT_EQ(file_probe::is_readable(paths[i], file_probe::type(paths[i])), expected_readability[i])
+                << paths[i];
+        }
+    }
+
+    // All results are probed, including the error of the symbolic link loop.
+    if (probed.is_complete())
+    {
+        EXPECT_EQ(file_probe::syscall_count(), 0u);
+    }
+}
+
+TEST_F(file_probe_test, batch_without_io_uring)
+{
+    using sharg::detail::file_probe;
+
+    file_probe::use_io_uring = false;
+    file_probe::reset_syscall_count();
+    {
+        file_probe::batch const probed{paths};
+        EXPECT_FALSE(probed.is_complete());
+    }
+    file_probe::use_io_uring = true;
+
+    EXPECT_EQ(file_probe::syscall_count(), 0u);
+}
+
+TEST_F(file_probe_test, nested_batches)
+{
+    using sharg::detail::file_probe;
+    using sharg::detail::file_type;
+
+    std::filesystem::path const other{directory / "other"};
+    std::vector<std::filesystem::path> const other_paths{other};
+
+    file_probe::batch const outer{paths};
+    {
+        file_probe::batch const inner{other_paths};
+        EXPECT_EQ(file_probe::type(other), file_type::not_found);
+        EXPECT_EQ(file_probe::type(paths[0]), file_type::regular);
+    }
+
+    // The outer batch is active again.
+    std::ofstream{other};
+    EXPECT_EQ(file_probe::type(other), file_type::regular);
+    file_probe::reset_syscall_count();
+    EXPECT_EQ(file_probe::type(paths[0]), file_type::regular);
+
+    if (outer.is_complete())
+    {
+        EXPECT_EQ(file_probe::syscall_count(), 0u);
+    }
+}
+
+TEST_F(file_probe_test, prefetch_with_timeout)
+{
+    using sharg::detail::file_probe;
+
+    std::ofstream{paths[1]} << "ACGT";
+    std::thread::id const caller = std::this_thread::get_id();
+
+    // Without a timeout, the file is prefetched by the calling thread.
+    std::thread::id prefetched_by{};
+    file_probe::prefetch(paths[1],
+                         false,
+                         [&prefetched_by](uint64_t const size)
+                         {
+                             prefetched_by = std::this_thread::get_id();
+                             return size;
+                         });
+    EXPECT_EQ(prefetched_by, caller);
+
+    // With a timeout, the system calls run on the worker thread, such that a hanging file system cannot block.
+    auto const thread_of_prefetch = std::make_shared<std::thread::id>();
+    sharg::detail::deadline::scope const timeout{std::chrono::seconds{10}};
+    file_probe::prefetch(paths[1],
+                         false,
+                         [thread_of_prefetch](uint64_t const size)
+                         {
+                             *thread_of_prefetch = std::this_thread::get_id();
+                             return size;
+                         });
+    EXPECT_NE(*thread_of_prefetch, std::thread::id{});
+    EXPECT_NE(*thread_of_prefetch, caller);
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include <sharg/detail/output_buffer.hpp>
+
+// detail::to_string must print the same as a std::ostringstream.
+template <typename value_t>
+std::string streamed(value_t const & value)
+{
+    std::ostringstream stream{};
+    stream << value;
+    return stream.str();
+}
+
+TEST(to_string, numbers)
+{
+    for (double const value : {0.0, -0.0, 1.0, 0.1, -2.5, 3.14159265, 1e-7, 123456.0, 1234567.0, 1e300, -1e-300})
+    {
+        EXPECT_EQ(sharg::detail::to_string(value), streamed(value));
+        EXPECT_EQ(sharg::detail::to_string(static_cast<float>(value)), streamed(static_cast<float>(value)));
+    }
+
+    EXPECT_EQ(sharg::detail::to_string(std::numeric_limits<double>::infinity()), "inf");
+    EXPECT_EQ(sharg::detail::to_string(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(sharg::detail::to_string(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+    EXPECT_EQ(sharg::detail::to_string(int8_t{-5}, ' ', uint8_t{200}), "-5 200");
+    EXPECT_EQ(sharg::detail::to_string(true, false), "10");
+}
+
+TEST(to_string, strings_and_containers)
+{
+    using namespace std::string_literals;
+
+    EXPECT_EQ(sharg::detail::to_string("a", 'b', "c"s), "abc");
+    EXPECT_EQ(sharg::detail::to_string(std::filesystem::path{"/a b"}), "\"/a b\"");
+    EXPECT_EQ(sharg::detail::to_string(std::vector<int>{}), "[]");
+    EXPECT_EQ(sharg::detail::to_string(std::vector<double>{1.5, 2.0}), "[1.5, 2]");
+    EXPECT_EQ(sharg::detail::to_string(std::vector<std::string>{"x", "y"}), "[x, y]");
+    EXPECT_EQ(sharg::detail::to_string(std::quoted("x")), "\"x\"");
+}
+
+TEST(output_buffer, write_to_stream)
+{
+    sharg::detail::output_buffer buffer{};
+    buffer << "section" << ' ' << 1u << ' ' << -2 << ' ' << 0.5 << '\n';
+    buffer.append(4, ' ');
+    buffer << std::string{"text"};
+
+    EXPECT_EQ(buffer.view(), "section 1 -2 0.5\n    text");
+
+    std::ostringstream stream{};
+    buffer.write_to(stream);
+    EXPECT_EQ(stream.str(), "section 1 -2 0.5\n    text");
+    EXPECT_TRUE(buffer.view().empty());
+}
+
+TEST(output_buffer, write_to_cout)
+{
+    sharg::detail::output_buffer buffer{};
+    buffer << "page\n";
+
+    // Output that is still buffered by std::cout is written before the page.
+    testing::internal::CaptureStdout();
+    std::cout << "before\n";
+    buffer.write_to(std::cout);
+    std::cout << "after\n";
+    std::cout.flush();
+    EXPECT_EQ(testing::internal::GetCapturedStdout(), "before\npage\nafter\n");
+    EXPECT_TRUE(std::cout.good());
+
+    // A redirected std::cout is respected.
+    std::ostringstream stream{};
+    std::streambuf * const original = std::cout.rdbuf(stream.rdbuf());
+    buffer << "page\n";
+    buffer.write_to(std::cout);
+    std::cout.rdbuf(original);
+    EXPECT_EQ(stream.str(), "page\n");
+}
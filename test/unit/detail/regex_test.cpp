@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <sharg/detail/regex.hpp>
+
+using sharg::detail::regex_status;
+
+static regex_status compile_status(std::string_view const pattern)
+{
+    return sharg::detail::regex_compiler{pattern}.compile().status;
+}
+
+TEST(regex_test, same_as_std_regex)
+{
+    std::vector<std::string> const patterns{"",
+                                            "()",
+                                            "a*",
+                                            "a{3,}",
+                                            "a{2,3}",
+                                            "(a|b)*abb",
+                                            "(ab){0,2}c?",
+                                            "(a*)*b",
+                                            "a(b|c|)d",
+                                            "x|",
+                                            "(?:ab|cd)+?",
+                                            ".",
+                                            "tt",
+                                            "[0-9]",
+                                            "^chr[0-9]+",
+                                            "[^abc]+",
+                                            "[-a]",
+                                            "[a-]",
+                                            "[a\\-z]",
+                                            "[\\d.]+",
+                                            "[\\x30-\\x39]+",
+                                            "\\x41+",
+                                            "\\d+\\s\\w*",
+                                            ".*oll.*",
+                                            "[a-zA-Z]+@[a-zA-Z]+\\.com",
+                                            "(/[^/]+)+/.*\\.[^/\\.]+$",
+                                            "^a|^b$"};
+
+    std::vector<std::string> const strings{"",     "a",    "aa",   "aaa",   "aaaa",     "b",          "ab",
+                                           "abb",  "aabb", "abab", "ababc", "abc",      "c",          "x",
+                                           "tt",   "ttt",  "1",    "12",    "1.2.3",    "chr",        "chr1",
+                                           "d",    "-",    "z",    "A",     "AAA",      "09",         "1 x_",
+                                           "ad",   "abd",  "acd",  "abcd",  "poll",     "a@b.de",     "a@b.com",
+                                           "\n",   "\r",   "a\nb", "/a/b",  "/a/b.txt", "/a/.b/c.txt"};
+
+    for (std::string const & pattern : patterns)
+    {
+        sharg::detail::regex_dfa const dfa = sharg::detail::regex_compiler{pattern}.compile();
+        ASSERT_EQ(dfa.status, regex_status::ok) << pattern;
+        std::regex const expected{pattern};
+
+        for (std::string const & str : strings)
+        {
+            EXPECT_EQ(dfa.match(str), std::regex_match(str, expected)) << pattern << " " << str;
+
+            size_t longest_prefix{std::string_view::npos};
+            for (size_t length = 0; length <= str.size(); ++length)
+                if (std::regex_match(str.begin(), str.begin() + length, expected))
+                    longest_prefix = length;
+
+            EXPECT_EQ(dfa.longest_prefix(str), longest_prefix) << pattern << " " << str;
+        }
+    }
+}
+
+TEST(regex_test, invalid)
+{
+    for (std::string_view const pattern : {"a**", "(a", "a)", "[a", "a{2,1}", "\\", "a{", "*a", "[z-a]", "\\x4"})
+        EXPECT_EQ(compile_status(pattern), regex_status::invalid) << pattern;
+}
+
+TEST(regex_test, unsupported)
+{
+    for (std::string_view const pattern : {"(a)\\1", "\\bfoo", "(?=a)", "[[:digit:]]", "a]", "a^b", "(a$)", "[]a]"})
+        EXPECT_EQ(compile_status(pattern), regex_status::unsupported) << pattern;
+}
+
+TEST(regex_test, too_complex)
+{
+    EXPECT_EQ(compile_status("(a|b)*a(a|b){20}"), regex_status::too_complex); // 2^21 states
+    EXPECT_EQ(compile_status("(a{100}){100}"), regex_status::too_complex);    // 10'000 positions
+    EXPECT_EQ(compile_status("a{1001}"), regex_status::too_complex);
+    EXPECT_EQ(compile_status("(a|b)*a(a|b){5}"), regex_status::ok);
+}
+
+TEST(regex_test, static_regex)
+{
+    using app_name = sharg::detail::static_regex<"^[a-zA-Z0-9_-]+$">;
+    using version = sharg::detail::static_regex<"[0-9]+\\.[0-9]+\\.[0-9]+">;
+
+    static_assert(app_name::match("my_app-1"));
+    static_assert(!app_name::match("my app"));
+    static_assert(!app_name::match(""));
+    static_assert(version::longest_prefix("1.22.3-rc1") == 6u);
+    static_assert(version::longest_prefix("1.22") == std::string_view::npos);
+
+    // More than 256 states.
+    using long_pattern = sharg::detail::static_regex<"a{300}">;
+    EXPECT_TRUE(long_pattern::match(std::string(300, 'a')));
+    EXPECT_FALSE(long_pattern::match(std::string(299, 'a')));
+    EXPECT_FALSE(long_pattern::match(std::string(301, 'a')));
+}
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/suffix_matcher.hpp>
+
+TEST(suffix_matcher_test, matches)
+{
+    sharg::detail::suffix_matcher const matcher{{"fa", "fasta", "FASTA.gz", "sam", "bam"}};
+
+    EXPECT_EQ(matcher.size(), 5u);
+    EXPECT_TRUE(matcher.matches("reads.fa"));
+    EXPECT_TRUE(matcher.matches("reads.FA"));
+    EXPECT_TRUE(matcher.matches("reads.fasta"));
+    EXPECT_TRUE(matcher.matches("reads.fasta.GZ"));
+    EXPECT_TRUE(matcher.matches("sam"));
+    EXPECT_TRUE(matcher.matches("reads.Bam"));
+    EXPECT_FALSE(matcher.matches("reads.fastq"));
+    EXPECT_FALSE(matcher.matches("reads.gz"));
+    EXPECT_FALSE(matcher.matches("am"));
+    EXPECT_FALSE(matcher.matches(""));
+}
+
+TEST(suffix_matcher_test, empty)
+{
+    EXPECT_FALSE(sharg::detail::suffix_matcher{}.matches("reads.fa"));
+    EXPECT_EQ(sharg::detail::suffix_matcher{}.size(), 0u);
+
+    // The empty suffix matches every string.
+    sharg::detail::suffix_matcher const matcher{{"fa", ""}};
+    EXPECT_TRUE(matcher.matches("reads.fq"));
+    EXPECT_TRUE(matcher.matches(""));
+}
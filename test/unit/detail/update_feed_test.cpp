@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sharg/detail/update_feed.hpp>
+#include <sharg/test/tmp_filename.hpp>
+#include <sharg/test/update_feed_server.hpp>
+
+struct update_feed_test : public ::testing::Test
+{
+    sharg::test::tmp_filename const tmp{"feed"};
+    std::filesystem::path const directory{tmp.get_path().parent_path()};
+    std::filesystem::path const version_file{directory / "app.version"};
+    std::string const query{"SeqAn-Sharg_Linux_64_app_1.0.0"};
+
+    sharg::detail::downloader const no_downloader{};
+    sharg::detail::version_check_cancellation cancellation{};
+
+    std::string read_version_file() const
+    {
+        std::ifstream stream{version_file};
+        return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    }
+};
+
+TEST_F(update_feed_test, is_valid)
+{
+    using sharg::detail::update_feed;
+
+    EXPECT_TRUE(update_feed{}.is_valid());
+    EXPECT_TRUE(update_feed{}.is_remote());
+    EXPECT_TRUE(update_feed{"https://mirror.example.org:8443/check/"}.is_remote());
+    EXPECT_TRUE(update_feed{"http://mirror/check/"}.is_remote());
+    EXPECT_TRUE(update_feed{"file:///srv/sharg/"}.is_valid());
+    EXPECT_FALSE(update_feed{"file:///srv/sharg/"}.is_remote());
+
+    // The URL is passed to the downloader.
+    EXPECT_FALSE(update_feed{"https://mirror/check/ --output=/etc/passwd"}.is_valid());
+    EXPECT_FALSE(update_feed{"https://mirror/check/;reboot"}.is_valid());
+    EXPECT_FALSE(update_feed{"ftp://mirror/check/"}.is_valid());
+    EXPECT_FALSE(update_feed{""}.is_valid());
+}
+
+TEST_F(update_feed_test, select)
+{
+    using sharg::detail::update_feed;
+
+    unsetenv("SHARG_UPDATE_FEED");
+    EXPECT_TRUE(update_feed::select("").is_remote());
+    EXPECT_FALSE(update_feed::select("file:///srv/sharg/").is_remote());
+
+    // The environment variable overrides the feed of the application.
+    setenv("SHARG_UPDATE_FEED", "https://mirror/check/", 1);
+    EXPECT_TRUE(update_feed::select("file:///srv/sharg/").is_remote());
+    unsetenv("SHARG_UPDATE_FEED");
+}
+
+TEST_F(update_feed_test, function)
+{
+    sharg::detail::update_feed const feed{[](std::string const & query) -> std::optional<std::string>
+                                          {
+                                              if (query.ends_with("_1.0.0"))
+                                                  return "2.0.0\n1.1.2\n";
+                                              return std::nullopt;
+                                          }};
+
+    EXPECT_TRUE(feed.fetch(query, version_file, no_downloader, cancellation));
+    EXPECT_EQ(read_version_file(), "2.0.0\n1.1.2\n");
+    EXPECT_FALSE(feed.fetch("SeqAn-Sharg_Linux_64_app_2.0.0", version_file, no_downloader, cancellation));
+}
+
+TEST_F(update_feed_test, file)
+{
+    std::filesystem::create_directory(directory / "feed");
+    std::ofstream{directory / "feed" / query} << "UNREGISTERED_APP\n1.1.2\n";
+
+    sharg::detail::update_feed const feed{"file://" + (directory / "feed").string() + "/"};
+
+    EXPECT_TRUE(feed.fetch(query, version_file, no_downloader, cancellation));
+    EXPECT_EQ(read_version_file(), "UNREGISTERED_APP\n1.1.2\n");
+    EXPECT_FALSE(feed.fetch("SeqAn-Sharg_Linux_64_other_1.0.0", version_file, no_downloader, cancellation));
+    EXPECT_EQ(read_version_file(), "UNREGISTERED_APP\n1.1.2\n");
+}
+
+#if !defined(_WIN32)
+TEST_F(update_feed_test, unix_socket)
+{
+    sharg::test::update_feed_server const server{directory / "feed.sock", "2.0.0\n1.1.2\n"};
+    sharg::detail::update_feed const feed{server.url()};
+
+    EXPECT_FALSE(feed.is_remote());
+    EXPECT_TRUE(feed.fetch(query, version_file, no_downloader, cancellation));
+    EXPECT_EQ(read_version_file(), "2.0.0\n1.1.2\n");
+    EXPECT_EQ(server.last_target(), "/" + query);
+    EXPECT_EQ(server.request_count(), 1u);
+
+    sharg::detail::update_feed const missing{"unix://" + (directory / "missing.sock").string()};
+    EXPECT_FALSE(missing.fetch(query, version_file, no_downloader, cancellation));
+}
+
+TEST_F(update_feed_test, http)
+{
+    // The downloader writes a partial file, which replaces the version file if the download succeeds.
+    std::filesystem::path const script = directory / "downloader";
+    {
+        std::ofstream stream{script};
+        stream << "#!/bin/sh\nprintf '2.0.0\\n1.1.2\\n' > \"$1\"\n";
+        stream << "[ \"$2\" = 'https://mirror/check/" << query << "' ]\n";
+    }
+    std::filesystem::permissions(script, std::filesystem::perms::owner_all);
+
+    sharg::detail::update_feed const feed{"https://mirror/check/"};
+    sharg::detail::downloader const program{.name = "test", .options = {}, .path = script};
+
+    EXPECT_TRUE(feed.fetch(query, version_file, program, cancellation));
+    EXPECT_EQ(read_version_file(), "2.0.0\n1.1.2\n");
+
+    std::filesystem::remove(version_file);
+    EXPECT_FALSE(feed.fetch("SeqAn-Sharg_Linux_64_other_1.0.0", version_file, program, cancellation));
+    EXPECT_FALSE(std::filesystem::exists(version_file));
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator{directory}, {}), 1); // Only the downloader is left.
+}
+#endif
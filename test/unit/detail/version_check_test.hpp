@@ -9,6 +9,7 @@
 #include <sharg/parser.hpp>
 #include <sharg/test/test_fixture.hpp>
 #include <sharg/test/tmp_filename.hpp>
+#include <sharg/test/update_feed_server.hpp>
 
 //------------------------------------------------------------------------------
 // test fixtures
@@ -56,6 +57,10 @@ protected:
     {
         // set HOME environment to a random home folder before starting each test case
         randomise_home_folder();
+
+        // the version check is skipped in jobs of batch schedulers
+        for (char const * const variable : {"SLURM_JOB_ID", "PBS_JOBID", "LSB_JOBID"})
+            unsetenv(variable);
     }
 
     static std::filesystem::path app_tmp_path()
@@ -81,6 +86,24 @@ protected:
 
     static inline std::regex const timestamp_regex{"^[[:digit:]]+$"}; // only digits
 
+    // Unsets the environment variable SHARG_NO_VERSION_CHECK and returns its value for resetting it.
+    static std::string unset_no_version_check()
+    {
+        std::string result{};
+        if (char * env = std::getenv("SHARG_NO_VERSION_CHECK"))
+        {
+            result = env;
+            unsetenv("SHARG_NO_VERSION_CHECK");
+        }
+        return result;
+    }
+
+    static void reset_no_version_check(std::string const & cached_env_var)
+    {
+        if (!cached_env_var.empty())
+            setenv("SHARG_NO_VERSION_CHECK", cached_env_var.c_str(), 1);
+    }
+
     template <typename... arg_ts>
     std::tuple<std::string, std::string, bool> simulate_parser(arg_ts &&... args)
     {
@@ -210,6 +233,275 @@ TEST_F(version_check_test, sanity_cookie)
     }
 }
 
+#if !defined(_WIN32)
+TEST_F(version_check_test, find_downloader)
+{
+    using sharg::detail::version_checker;
+
+    std::filesystem::path const directory = tmp_file.get_path().parent_path();
+    std::filesystem::path const bin = directory / "bin";
+    std::filesystem::create_directory(bin);
+
+    std::filesystem::path const other_bin = directory / "other_bin";
+    std::filesystem::create_directory(other_bin);
+
+    auto create_program = [](std::filesystem::path const & program)
+    {
+        std::ofstream{program} << "#!/bin/sh\nexit 0\n";
+        std::filesystem::permissions(program, std::filesystem::perms::owner_all);
+    };
+    create_program(bin / "curl");
+    create_program(other_bin / "curl");
+
+    std::filesystem::path const cache_file = directory / "downloader";
+    auto read_cache = [&cache_file]()
+    {
+        std::ifstream cache{cache_file};
+        return std::string{std::istreambuf_iterator<char>{cache}, std::istreambuf_iterator<char>{}};
+    };
+
+    char const * const path_variable = std::getenv("PATH");
+    std::string const cached_path = path_variable != nullptr ? path_variable : "";
+
+    // Relative directories are skipped.
+    setenv("PATH", ("bin:" + bin.string()).c_str(), 1);
+    sharg::detail::downloader found = version_checker::find_downloader(directory);
+    EXPECT_EQ(found.name, "curl");
+    EXPECT_EQ(found.path, bin / "curl");
+    EXPECT_EQ(read_cache(), "curl\n" + (bin / "curl").string() + '\n');
+
+    // The cache is not writable by the group or others.
+    using std::filesystem::perms;
+    perms const cache_permissions = std::filesystem::status(cache_file).permissions();
+    EXPECT_EQ(cache_permissions & (perms::group_write | perms::others_write), perms::none);
+
+    // The cached downloader is used without searching the PATH, which would find the preferred wget.
+    create_program(bin / "wget");
+    EXPECT_EQ(version_checker::find_downloader({}).path, bin / "wget");
+    EXPECT_EQ(version_checker::find_downloader(directory).path, bin / "curl");
+
+    // A cache that is writable by the group is ignored and replaced.
+    std::filesystem::permissions(cache_file, perms::group_write, std::filesystem::perm_options::add);
+    EXPECT_EQ(version_checker::find_downloader(directory).path, bin / "wget");
+    EXPECT_EQ(read_cache(), "wget\n" + (bin / "wget").string() + '\n');
+
+    // A cached downloader that is not in a directory of the PATH anymore is ignored.
+    setenv("PATH", other_bin.string().c_str(), 1);
+    EXPECT_EQ(version_checker::find_downloader(directory).path, other_bin / "curl");
+
+    // A cached downloader that does not exist anymore is ignored.
+    std::filesystem::remove(other_bin / "curl");
+    EXPECT_TRUE(version_checker::find_downloader(directory).path.empty());
+
+    // The cache in the temporary directory is neither used nor written.
+    char const * const tmpdir_variable = std::getenv("TMPDIR");
+    std::optional<std::string> const cached_tmpdir =
+        tmpdir_variable != nullptr ? std::optional<std::string>{tmpdir_variable} : std::nullopt;
+    setenv("TMPDIR", directory.c_str(), 1);
+    setenv("PATH", (bin.string() + ':' + other_bin.string()).c_str(), 1);
+    create_program(other_bin / "curl");
+    std::filesystem::remove(cache_file);
+    EXPECT_EQ(version_checker::find_downloader(directory).path, bin / "wget");
+    EXPECT_FALSE(std::filesystem::exists(cache_file));
+
+    std::ofstream{cache_file} << "curl\n" << (other_bin / "curl").string() << '\n';
+    EXPECT_EQ(version_checker::find_downloader(directory).path, bin / "wget");
+    EXPECT_EQ(read_cache(), "curl\n" + (other_bin / "curl").string() + '\n');
+
+    if (cached_tmpdir.has_value())
+        setenv("TMPDIR", cached_tmpdir->c_str(), 1);
+    else
+        unsetenv("TMPDIR");
+
+    setenv("PATH", cached_path.c_str(), 1);
+}
+
+TEST_F(version_check_test, run_program)
+{
+    using sharg::detail::run_program;
+
+    // The environment is empty.
+    EXPECT_TRUE(run_program({"/bin/sh", "-c", "test -z \"$HOME\""}));
+    EXPECT_FALSE(run_program({"/bin/sh", "-c", "exit 3"}));
+    EXPECT_FALSE(run_program({"/does/not/exist"}));
+}
+
+TEST_F(version_check_test, cancel)
+{
+    using sharg::detail::version_checker;
+
+    std::filesystem::path const directory = tmp_file.get_path().parent_path();
+    std::filesystem::path const bin = directory / "bin";
+    std::filesystem::path const started = directory / "started";
+    std::filesystem::create_directory(bin);
+
+    auto create_downloader = [&](std::string_view const command)
+    {
+        {
+            std::ofstream script{bin / "wget"};
+            script << "#!/bin/sh\n: > " << started << '\n' << command << '\n';
+        }
+        std::filesystem::permissions(bin / "wget", std::filesystem::perms::owner_all);
+    };
+    create_downloader("exec /bin/sleep 30");
+
+    char const * const path_variable = std::getenv("PATH");
+    std::string const cached_path = path_variable != nullptr ? path_variable : "";
+    setenv("PATH", bin.string().c_str(), 1);
+
+    // The downloader is killed when the check is cancelled; the host is not marked as offline.
+    {
+        auto cancellation = std::make_shared<sharg::detail::version_check_cancellation>();
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        version_checker{app_name, "2.3.4"}(std::move(prom), cancellation);
+
+        EXPECT_EQ(future.wait_for(std::chrono::milliseconds{100}), std::future_status::timeout);
+        cancellation->cancel();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+        EXPECT_FALSE(future.get());
+        EXPECT_FALSE(std::filesystem::exists(app_tmp_path() / "offline"));
+    }
+
+    // A downloader that ran and failed marks the host as offline.
+    {
+        create_downloader("exit 1");
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        version_checker{app_name, "2.3.4"}(std::move(prom));
+
+        EXPECT_FALSE(future.get());
+        EXPECT_TRUE(std::filesystem::exists(started));
+        EXPECT_TRUE(std::filesystem::exists(app_tmp_path() / "offline"));
+    }
+
+    // The host is marked as offline, hence the downloader is not started.
+    {
+        std::filesystem::remove(started);
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        version_checker{app_name, "2.3.4"}(std::move(prom));
+
+        EXPECT_FALSE(future.get());
+        EXPECT_FALSE(std::filesystem::exists(started));
+    }
+
+    // The parser does not wait for the version check on destruction. After the application exited, the host is not
+    // marked as offline, whether the downloader was killed or succeeded while the application exited.
+    {
+        std::filesystem::remove(app_tmp_path() / "offline");
+        std::string const cached_env_var = unset_no_version_check();
+
+        auto run_application = [this]()
+        {
+            bool flag{false};
+            std::vector<std::string> arguments{app_name, OPTION_VERSION_CHECK, OPTION_ON, "-f"};
+            sharg::parser parser{app_name, std::move(arguments), sharg::update_notifications::on};
+            parser.add_flag(flag, sharg::config{.short_id = 'f'});
+            parser.parse();
+        };
+
+        // wget writes the response to the 5th argument.
+        for (std::string_view const command :
+             {"exec /bin/sleep 30", "echo > \"$5\"", "echo > \"$5\"", "echo > \"$5\"", "echo > \"$5\""})
+        {
+            std::filesystem::remove(app_tmp_path() / "downloader");
+            create_downloader(command);
+
+            auto const start = std::chrono::steady_clock::now();
+            // std::_Exit skips the check of the test fixture that all tests ran.
+            EXPECT_EXIT((run_application(), std::_Exit(EXIT_SUCCESS)), testing::ExitedWithCode(EXIT_SUCCESS), "");
+            EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{3});
+
+            EXPECT_TRUE(std::filesystem::exists(app_tmp_path() / "downloader")); // The version check was started.
+            EXPECT_FALSE(std::filesystem::exists(app_tmp_path() / "offline"));
+        }
+
+        reset_no_version_check(cached_env_var);
+    }
+
+    setenv("PATH", cached_path.c_str(), 1);
+}
+
+TEST_F(version_check_test, lease)
+{
+    using sharg::detail::version_checker;
+
+    std::string const cached_env_var = unset_no_version_check();
+    sharg::detail::version_checker checker{app_name, "2.3.4"};
+    std::filesystem::path const lease_file = app_tmp_path() / (app_name + ".lease");
+
+    EXPECT_EQ(version_checker::decide_without_cookie(app_name, sharg::update_notifications::on, {}), std::nullopt);
+
+    // Only one version_checker takes the lease.
+    EXPECT_TRUE(checker.take_lease());
+    EXPECT_TRUE(std::filesystem::exists(lease_file));
+    EXPECT_FALSE(checker.take_lease());
+    EXPECT_FALSE(checker.decide_if_check_is_performed(sharg::update_notifications::on, std::nullopt));
+    EXPECT_EQ(version_checker::decide_without_cookie(app_name, sharg::update_notifications::on, {}), false);
+
+    // The user decision still applies.
+    EXPECT_EQ(version_checker::decide_without_cookie(app_name, sharg::update_notifications::on, true), true);
+
+    // The lease cannot be taken while another process holds the lock.
+    std::filesystem::remove(lease_file);
+    int const lock_file = ::open((app_tmp_path() / (app_name + ".lock")).c_str(), O_RDWR | O_CLOEXEC);
+    ASSERT_NE(lock_file, -1);
+    ASSERT_EQ(::flock(lock_file, LOCK_EX | LOCK_NB), 0);
+    EXPECT_FALSE(checker.take_lease());
+    ::close(lock_file);
+    EXPECT_TRUE(checker.take_lease());
+
+    reset_no_version_check(cached_env_var);
+}
+#endif
+
+TEST_F(version_check_test, batch_job)
+{
+    using sharg::detail::version_checker;
+
+    std::string const cached_env_var = unset_no_version_check();
+    setenv("SLURM_JOB_ID", "42", 1);
+    EXPECT_EQ(version_checker::decide_without_cookie(app_name, sharg::update_notifications::on, {}), false);
+    EXPECT_EQ(version_checker::decide_without_cookie(app_name, sharg::update_notifications::on, true), true);
+
+    auto [out, err, app_call_succeeded] = simulate_parser("-f");
+    EXPECT_FALSE(app_call_succeeded);
+    EXPECT_FALSE(std::filesystem::exists(app_timestamp_filename()));
+    unsetenv("SLURM_JOB_ID");
+    reset_no_version_check(cached_env_var);
+}
+
+#if !defined(_WIN32)
+TEST_F(version_check_test, update_feed)
+{
+    sharg::test::update_feed_server const server{tmp_file.get_path().parent_path() / "feed.sock", "20.5.9\n1.0.0\n"};
+    std::string const cached_env_var = unset_no_version_check();
+
+    bool flag{false};
+    sharg::parser parser{app_name, {app_name, OPTION_VERSION_CHECK, OPTION_ON, "-f"}, sharg::update_notifications::on};
+    parser.info.version = "2.3.4";
+    parser.add_flag(flag, sharg::config{.short_id = 'f'});
+    parser.set_update_feed(server.url());
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(wait_for(parser));
+    EXPECT_THROW(parser.set_update_feed(server.url()), sharg::design_error);
+
+    reset_no_version_check(cached_env_var);
+
+    EXPECT_TRUE(server.last_target().ends_with("_" + app_name + "_2.3.4")) << server.last_target();
+    EXPECT_FALSE(std::filesystem::exists(app_tmp_path() / "offline")); // The feed is not remote.
+
+    std::ifstream version_file{app_version_filename()};
+    std::string line{};
+    std::getline(version_file, line);
+    EXPECT_EQ(line, "20.5.9");
+
+    sharg::parser other_parser{app_name, {app_name}};
+    EXPECT_THROW(other_parser.set_update_feed("ftp://mirror/check/"), sharg::design_error);
+}
+#endif
+
 //------------------------------------------------------------------------------
 // version checks
 //------------------------------------------------------------------------------
@@ -94,6 +94,8 @@ TEST_F(enumeration_names_test, issue2464)
     parser = get_parser("-e", "one", "-e", "nine");
     parser.add_option(option_values, sharg::config{.short_id = 'e'});
     EXPECT_THROW(parser.parse(), sharg::user_input_error);
+    // The invalid value is not appended to the list.
+    EXPECT_TRUE(option_values == std::vector<foo::bar>{foo::bar::one});
 
     // Invalid inputs for enums are handled before any validator is evaluated.
     // Thus the exception will be sharg::user_input_error and not sharg::validation_error.
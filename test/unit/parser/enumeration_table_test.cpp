@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ranges>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+namespace foo
+{
+
+enum class bar
+{
+    one,
+    two,
+    three
+};
+
+constexpr auto enumeration_names(bar)
+{
+    return sharg::enumeration_table<bar, 4>{
+        {{"one", bar::one}, {"two", bar::two}, {"three", bar::three}, {"3", bar::three}}};
+}
+
+} // namespace foo
+
+namespace Other
+{
+
+enum class bar
+{
+    one,
+    two
+};
+
+} // namespace Other
+
+namespace sharg::custom
+{
+
+template <>
+struct parsing<Other::bar>
+{
+    static constexpr sharg::enumeration_table<Other::bar, 2> enumeration_names{{{"one", Other::bar::one},
+                                                                                {"two", Other::bar::two}}};
+};
+
+} // namespace sharg::custom
+
+static_assert(sharg::named_enumeration<foo::bar>);
+static_assert(sharg::named_enumeration<Other::bar>);
+static_assert(sharg::parsable<foo::bar>);
+
+// Lookup in a constant expression.
+static constexpr auto table = foo::enumeration_names(foo::bar{});
+static_assert(table.size() == 4u);
+static_assert(table.find("two")->second == foo::bar::two);
+static_assert(table.find("3")->second == foo::bar::three);
+static_assert(table.find("four") == table.end());
+static_assert(table.find("") == table.end());
+
+class enumeration_table_test : public sharg::test::test_fixture
+{};
+
+TEST_F(enumeration_table_test, iteration_order)
+{
+    auto names = table | std::views::keys;
+    EXPECT_TRUE(std::ranges::equal(names, std::vector<std::string_view>{"one", "two", "three", "3"}));
+}
+
+TEST_F(enumeration_table_test, many_entries)
+{
+    constexpr size_t count = 300u;
+
+    std::vector<std::string> names{};
+    for (size_t i = 0; i < count; ++i)
+        names.push_back("name_" + std::to_string(i));
+
+    std::pair<std::string_view, size_t> pairs[count];
+    for (size_t i = 0; i < count; ++i)
+        pairs[i] = {names[i], i};
+
+    sharg::enumeration_table<size_t, count> const many{pairs};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto it = many.find(names[i]);
+        ASSERT_NE(it, many.end());
+        EXPECT_EQ(it->second, i);
+    }
+
+    EXPECT_EQ(many.find("name_"), many.end());
+    EXPECT_EQ(many.find("name_300"), many.end());
+}
+
+TEST_F(enumeration_table_test, duplicate_name)
+{
+    using table_t = sharg::enumeration_table<int, 3>;
+    EXPECT_THROW_MSG((table_t{{{"a", 1}, {"b", 2}, {"a", 3}}}),
+                     sharg::design_error,
+                     "The name a occurs more than once in the enumeration table.");
+}
+
+TEST_F(enumeration_table_test, parse)
+{
+    foo::bar value{};
+    Other::bar other_value{};
+
+    auto parser = get_parser("-e", "3", "-o", "two");
+    parser.add_option(value, sharg::config{.short_id = 'e'});
+    parser.add_option(other_value, sharg::config{.short_id = 'o'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, foo::bar::three);
+    EXPECT_EQ(other_value, Other::bar::two);
+
+    parser = get_parser("-o", "three");
+    parser.add_option(other_value, sharg::config{.short_id = 'o'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "You have chosen an invalid input value: three. Please use one of: [one, two]");
+}
+
+TEST_F(enumeration_table_test, print)
+{
+    std::ostringstream stream{};
+    stream << foo::bar::two << ' ' << Other::bar::one;
+    EXPECT_EQ(stream.str(), "two one");
+}
@@ -13,6 +13,24 @@
 class format_parse_test : public sharg::test::test_fixture
 {};
 
+// Counts how often it is called.
+struct counting_validator
+{
+    using option_value_type = std::vector<int>;
+
+    size_t * calls{};
+
+    void operator()(option_value_type const &) const
+    {
+        ++*calls;
+    }
+
+    std::string get_help_page_message() const
+    {
+        return "";
+    }
+};
+
 TEST_F(format_parse_test, add_option_short_id)
 {
     std::string option_value;
@@ -93,6 +111,52 @@ TEST_F(format_parse_test, add_flag_short_id_multiple)
     EXPECT_EQ(option_value4, true);
 }
 
+TEST_F(format_parse_test, add_flag_short_id_cluster)
+{
+    bool flag_a{false};
+    bool flag_b{false};
+    bool flag_v{false};
+    std::vector<std::string> positional_options{};
+
+    // flags may be spread over several clusters
+    auto parser = get_parser("-ab", "-v");
+    parser.add_flag(flag_a, sharg::config{.short_id = 'a'});
+    parser.add_flag(flag_b, sharg::config{.short_id = 'b'});
+    parser.add_flag(flag_v, sharg::config{.short_id = 'v'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(flag_a);
+    EXPECT_TRUE(flag_b);
+    EXPECT_TRUE(flag_v);
+
+    // the remaining unknown flags of a cluster are reported
+    flag_a = flag_b = false;
+    parser = get_parser("-axyb");
+    parser.add_flag(flag_a, sharg::config{.short_id = 'a'});
+    parser.add_flag(flag_b, sharg::config{.short_id = 'b'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::unknown_option,
+                     "Unknown flags -x and -y. In case this is meant to be a non-option/argument/parameter, please "
+                     "specify the start of arguments with '--'. See -h/--help for program information.");
+
+    // a repeated flag is only consumed once
+    flag_v = false;
+    parser = get_parser("-vv");
+    parser.add_flag(flag_v, sharg::config{.short_id = 'v'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::unknown_option,
+                     "Unknown option -v. In case this is meant to be a non-option/argument/parameter, please "
+                     "specify the start of non-options with '--'. See -h/--help for program information.");
+
+    // flags after -- are positional options
+    flag_v = false;
+    parser = get_parser("--", "-v");
+    parser.add_flag(flag_v, sharg::config{.short_id = 'v'});
+    parser.add_positional_option(positional_options, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_FALSE(flag_v);
+    EXPECT_EQ(positional_options, std::vector<std::string>{"-v"});
+}
+
 TEST_F(format_parse_test, add_flag_long_id)
 {
     bool option_value1{false};
@@ -597,6 +661,27 @@ TEST_F(format_parse_test, argv_const_combinations)
     check_and_reset();
 }
 
+TEST_F(format_parse_test, argv_subcommand)
+{
+    std::string option_value{};
+    std::vector<std::string> positional_values{};
+    bool flag_value{false};
+
+    char const * argv[] = {"./top", "-f", "build", "-o", "value", "--", "-p", ""};
+
+    sharg::parser top_level_parser{"top", 8, argv, sharg::update_notifications::off, {"build"}};
+    top_level_parser.add_flag(flag_value, sharg::config{.short_id = 'f'});
+    EXPECT_NO_THROW(top_level_parser.parse());
+    EXPECT_TRUE(flag_value);
+
+    sharg::parser & sub_parser = top_level_parser.get_sub_parser();
+    sub_parser.add_option(option_value, sharg::config{.short_id = 'o'});
+    sub_parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(option_value, "value");
+    EXPECT_EQ(positional_values, std::vector<std::string>{"-p"}); // empty arguments are ignored
+}
+
 TEST_F(format_parse_test, multiple_empty_options)
 {
     int option_value{};
@@ -797,6 +882,102 @@ TEST_F(format_parse_test, container_options)
     EXPECT_TRUE(bool_options == (std::vector<bool>{true, false, true}));
 }
 
+TEST_F(format_parse_test, container_options_list_separator)
+{
+    std::vector<double> double_options{};
+    std::vector<std::string> string_options{};
+
+    auto parser = get_parser("-d", "0.1,0.2", "-d=3", "-d4,5");
+    parser.add_option(double_options, sharg::config{.short_id = 'd', .list_separator = ','});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(double_options, (std::vector<double>{0.1, 0.2, 3, 4, 5}));
+
+    parser = get_parser("--double=0.1,0.2");
+    parser.add_option(double_options, sharg::config{.long_id = "double", .list_separator = ','});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(double_options, (std::vector<double>{0.1, 0.2}));
+
+    // empty elements are kept for strings
+    parser = get_parser("-s", "a:b::c:");
+    parser.add_option(string_options, sharg::config{.short_id = 's', .list_separator = ':'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_options, (std::vector<std::string>{"a", "b", "", "c", ""}));
+
+    // without a separator, the value is not split
+    parser = get_parser("-s", "a:b");
+    parser.add_option(string_options, sharg::config{.short_id = 's'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_options, (std::vector<std::string>{"a:b"}));
+
+    // empty elements are an error for numbers
+    parser = get_parser("-d", "1,,2");
+    parser.add_option(double_options, sharg::config{.short_id = 'd', .list_separator = ','});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for -d: Argument  could not be parsed as type double.");
+
+    parser = get_parser("-d", "1,1e400");
+    parser.add_option(double_options, sharg::config{.short_id = 'd', .list_separator = ','});
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+
+    // the validator is applied to the whole list
+    std::vector<int> int_options{};
+    size_t validator_calls{};
+
+    parser = get_parser("-i", "1,2,3", "-i", "4");
+    parser.add_option(int_options,
+                      sharg::config{.short_id = 'i',
+                                    .list_separator = ',',
+                                    .validator = counting_validator{&validator_calls}});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_options, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(validator_calls, 1u);
+
+    parser = get_parser("-i", "1,2,30");
+    parser.add_option(int_options,
+                      sharg::config{.short_id = 'i',
+                                    .list_separator = ',',
+                                    .validator = sharg::arithmetic_range_validator{0, 10}});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option -i: Value 30 is not in range [0,10].");
+}
+
+TEST_F(format_parse_test, identifier_used_as_value)
+{
+    std::vector<std::string> string_options{};
+    std::string string_option{};
+    bool flag_value{false};
+
+    // an identifier that is consumed as the value of another option is not found again
+    auto parser = get_parser("-s", "-s", "-s", "-t", "--long=-s", "-f");
+    parser.add_option(string_options, sharg::config{.short_id = 's'});
+    parser.add_option(string_option, sharg::config{.long_id = "long"});
+    parser.add_flag(flag_value, sharg::config{.short_id = 'f'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_options, (std::vector<std::string>{"-s", "-t"}));
+    EXPECT_EQ(string_option, "-s");
+    EXPECT_TRUE(flag_value);
+
+    // --long=value is no flag
+    flag_value = false;
+    parser = get_parser("--long=value", "--long");
+    parser.add_flag(flag_value, sharg::config{.long_id = "long"});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::unknown_option,
+                     "Unknown option --long=value. In case this is meant to be a non-option/argument/parameter, "
+                     "please specify the start of non-options with '--'. See -h/--help for program information.");
+    EXPECT_TRUE(flag_value);
+
+    // identifiers after -- are not considered
+    parser = get_parser("--long", "1", "--", "--long");
+    parser.add_option(string_option, sharg::config{.long_id = "long"});
+    parser.add_positional_option(string_options, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_option, "1");
+    EXPECT_EQ(string_options, (std::vector<std::string>{"--long"}));
+}
+
 // https://github.com/seqan/seqan3/issues/2393
 TEST_F(format_parse_test, container_default)
 {
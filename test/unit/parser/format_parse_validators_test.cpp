@@ -7,6 +7,7 @@
 #include <ranges>
 
 #include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
 #include <sharg/test/file_access.hpp>
 #include <sharg/test/test_fixture.hpp>
 #include <sharg/test/tmp_filename.hpp>
@@ -33,6 +34,7 @@ TEST_F(validator_test, fullfill_concept)
     EXPECT_TRUE(sharg::validator<sharg::input_directory_validator>);
     EXPECT_TRUE(sharg::validator<sharg::output_directory_validator>);
     EXPECT_TRUE(sharg::validator<sharg::regex_validator>);
+    EXPECT_TRUE(sharg::validator<sharg::static_regex_validator<"[0-9]+">>);
 
     EXPECT_TRUE(sharg::validator<decltype(sharg::input_file_validator{{"t"}} | sharg::regex_validator{".*"})>);
 }
@@ -174,9 +176,9 @@ TEST_F(validator_test, output_file)
 
     // file does exist but allow to overwrite it
     my_validator = sharg::output_file_validator{options::open_or_create, formats};
-    EXPECT_TRUE(std::filesystem::exists(existing_path)); // Todo: Expected?
+    EXPECT_TRUE(std::filesystem::exists(existing_path));
     EXPECT_NO_THROW(my_validator(existing_path));
-    EXPECT_FALSE(std::filesystem::exists(existing_path)); // Todo: Expected?
+    EXPECT_TRUE(std::filesystem::exists(existing_path)); // The existing file is neither truncated nor removed.
 
     // file has no extension.
     std::filesystem::path test_path = not_existing_path;
@@ -372,6 +374,564 @@ TEST_F(validator_test, output_directory)
     EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
 }
 
+TEST_F(validator_test, bulk_validation)
+{
+    sharg::test::tmp_filename const tmp{"bulk"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::filesystem::path> files{};
+    std::vector<std::string> missing_files{};
+    for (size_t i = 0; i < 300u; ++i)
+    {
+        files.push_back(directory / ("file_" + std::to_string(i) + (i % 2u ? ".FA" : ".fasta.txt")));
+        std::ofstream{files.back()};
+        missing_files.push_back((directory / ("missing_" + std::to_string(i) + ".fa")).string());
+    }
+
+    sharg::input_file_validator const input_validator{{"fa", "fasta.txt"}};
+    EXPECT_NO_THROW(input_validator(files));
+
+    // The first invalid path in input order is reported.
+    std::vector<std::filesystem::path> invalid_files{files};
+    invalid_files[250] = missing_files[250];
+    invalid_files[70] = missing_files[70];
+    invalid_files[200] = directory / "file_1.bam";
+    EXPECT_THROW_MSG(input_validator(invalid_files),
+                     sharg::validation_error,
+                     "The file \"" + missing_files[70] + "\" does not exist!");
+
+    invalid_files[70] = files[70];
+    std::ofstream{directory / "file_1.bam"};
+    EXPECT_THROW_MSG(input_validator(invalid_files),
+                     sharg::validation_error,
+                     "Expected one of the following valid extensions: [fa, fasta.txt]! Got bam instead!");
+
+    // Equal paths are validated once; otherwise, creating the file for the first path makes the second one fail.
+    std::vector<std::string> output_files{missing_files};
+    output_files[200] = output_files[10];
+    sharg::output_file_validator const output_validator{sharg::output_file_open_options::create_new, "fa"};
+    EXPECT_NO_THROW(output_validator(output_files));
+    EXPECT_FALSE(std::filesystem::exists(output_files[10]));
+
+    output_files[150] = files[1].string();
+    EXPECT_THROW_MSG(output_validator(output_files),
+                     sharg::validation_error,
+                     "The file \"" + files[1].string() + "\" already exists!");
+
+    std::vector<std::filesystem::path> directories(100u, directory);
+    EXPECT_NO_THROW(sharg::input_directory_validator{}(directories));
+    directories[99] = files[0];
+    EXPECT_THROW(sharg::input_directory_validator{}(directories), sharg::validation_error);
+}
+
+// A derived validator whose operator() is not thread-safe and that assigns the extensions directly.
+struct derived_file_validator : public sharg::input_file_validator
+{
+    derived_file_validator() : sharg::input_file_validator{{"fa"}}
+    {}
+
+    void operator()(std::filesystem::path const & path) const override
+    {
+        threads.push_back(std::this_thread::get_id()); // Not thread-safe.
+        sharg::input_file_validator::operator()(path);
+    }
+
+    using sharg::input_file_validator::operator();
+
+    void use_extension(std::string const & extension)
+    {
+        extensions = {extension};
+        extensions_str = "[" + extension + "]";
+    }
+
+    mutable std::vector<std::thread::id> threads{};
+};
+
+TEST_F(validator_test, derived_validator)
+{
+    sharg::test::tmp_filename const tmp{"derived"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::filesystem::path> files{};
+    for (size_t i = 0; i < 1000u; ++i)
+    {
+        files.push_back(directory / ("file_" + std::to_string(i) + ".fa"));
+        std::ofstream{files.back()};
+    }
+
+    // The paths are validated sequentially by derived validators.
+    derived_file_validator validator{};
+    EXPECT_NO_THROW(validator(files));
+    EXPECT_EQ(validator.threads, std::vector<std::thread::id>(files.size(), std::this_thread::get_id()));
+
+    // The extensions that are assigned directly are used, even if there are as many as before.
+    std::filesystem::path const fq_file = directory / "file.fq";
+    std::ofstream{fq_file};
+    validator.use_extension("fq");
+    EXPECT_NO_THROW(validator(fq_file));
+    EXPECT_THROW_MSG(validator(files[0]),
+                     sharg::validation_error,
+                     "Expected one of the following valid extensions: [fq]! Got fa instead!");
+}
+
+TEST_F(validator_test, batch_probing)
+{
+    sharg::test::tmp_filename const tmp{"batch"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::filesystem::path> files{};
+    for (size_t i = 0; i < 1000u; ++i)
+    {
+        files.push_back(directory / ("file_" + std::to_string(i) + ".fa"));
+        std::ofstream{files.back()};
+    }
+
+    // Returns the message of the exception or an empty string.
+    auto validate = [](auto const & validator, auto const & paths) -> std::string
+    {
+        try
+        {
+            validator(paths);
+        }
+        catch (sharg::validation_error const & error)
+        {
+            return error.what();
+        }
+        return {};
+    };
+
+    sharg::input_file_validator const input_validator = sharg::input_file_validator{{"fa"}}.use_io_uring();
+    sharg::input_directory_validator const directory_validator = sharg::input_directory_validator{}.use_io_uring();
+    std::vector<std::filesystem::path> invalid_files{files};
+    invalid_files[900] = directory / "missing.fa";
+    invalid_files[800] = directory / "file.bam";
+    std::ofstream{invalid_files[800]};
+    std::vector<std::filesystem::path> directories(100u, directory);
+    directories[50] = files[0];
+
+    // Probing with io_uring and validating concurrently gives the same results.
+    std::vector<std::string> messages{};
+    for (bool const use_io_uring : {true, false})
+    {
+        sharg::detail::file_probe::use_io_uring = use_io_uring;
+        sharg::file_validator_base::reset_syscall_count();
+        EXPECT_EQ(validate(input_validator, files), "");
+
+        // statx and faccessat for every file if io_uring is not used.
+        bool const is_batched = sharg::detail::file_probe::batch{files}.is_complete();
+        if (is_batched)
+        {
+            EXPECT_LT(sharg::file_validator_base::syscall_count(), files.size() / 10u);
+        }
+        else
+        {
+            EXPECT_GE(sharg::file_validator_base::syscall_count(), 2u * files.size());
+        }
+
+        messages.push_back(validate(input_validator, invalid_files));
+        messages.push_back(validate(directory_validator, directories));
+    }
+    sharg::detail::file_probe::use_io_uring = true;
+
+    // io_uring is opt-in: statx and faccessat for every file.
+    sharg::file_validator_base::reset_syscall_count();
+    EXPECT_EQ(validate(sharg::input_file_validator{{"fa"}}, files), "");
+    EXPECT_GE(sharg::file_validator_base::syscall_count(), 2u * files.size());
+
+    EXPECT_EQ(messages[0], "Expected one of the following valid extensions: [fa]! Got bam instead!");
+    EXPECT_EQ(messages[1], "The path \"" + files[0].string() + "\" is not a directory!");
+    EXPECT_EQ(messages[0], messages[2]);
+    EXPECT_EQ(messages[1], messages[3]);
+}
+
+// Accesses the file system, which does not respond.
+struct hanging_validator
+{
+    using option_value_type = std::string;
+
+    void operator()(std::string const & value) const
+    {
+        sharg::detail::deadline::run(value,
+                                     [](std::filesystem::path const &)
+                                     {
+                                         std::this_thread::sleep_for(std::chrono::milliseconds{500});
+                                     });
+    }
+
+    std::string get_help_page_message() const
+    {
+        return "";
+    }
+};
+
+TEST_F(validator_test, validation_timeout)
+{
+    sharg::test::tmp_filename const tmp{"timeout"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::string> arguments{"./test_parser", "-i", (directory / "file_0.fa").string()};
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        std::filesystem::path const file{directory / ("file_" + std::to_string(i) + ".fa")};
+        std::ofstream{file};
+        arguments.push_back(file.string());
+    }
+
+    // Within the timeout, the validators behave as before, including validating lists concurrently.
+    {
+        std::filesystem::path input{};
+        std::vector<std::filesystem::path> files{};
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        parser.set_validation_timeout(std::chrono::seconds{10});
+        parser.add_option(input, sharg::config{.short_id = 'i', .validator = sharg::input_file_validator{{"fa"}}});
+        parser.add_positional_option(files, sharg::config{.validator = sharg::input_file_validator{{"fa"}}});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(files.size(), 100u);
+        EXPECT_THROW(parser.set_validation_timeout(std::chrono::seconds{1}), sharg::design_error);
+    }
+
+    arguments[1] = "--input";
+    arguments[2] = "/mnt/stale/file.fa";
+    arguments.resize(3u);
+
+    {
+        std::string input{};
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        parser.set_validation_timeout(std::chrono::milliseconds{20});
+        parser.add_option(input, sharg::config{.long_id = "input", .validator = hanging_validator{}});
+        EXPECT_THROW_MSG(parser.parse(),
+                         sharg::validation_timeout,
+                         "Validation failed for option --input: The file system did not respond within 20 ms while "
+                         "checking \"/mnt/stale/file.fa\"!");
+    }
+}
+
+TEST_F(validator_test, async_validation)
+{
+    sharg::test::tmp_filename const tmp{"async"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::string> arguments{"./test_parser", "-n", "5", "-i", (directory / "file_0.fa").string()};
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        std::filesystem::path const file{directory / ("file_" + std::to_string(i) + ".fa")};
+        std::ofstream{file};
+        arguments.push_back(file.string());
+    }
+
+    // Returns the message of the validation error or an empty string.
+    auto parse = [&arguments](bool const async_validation) -> std::string
+    {
+        int number{};
+        std::filesystem::path input{};
+        std::vector<std::filesystem::path> files{};
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        parser.add_option(number,
+                          sharg::config{.short_id = 'n', .validator = sharg::arithmetic_range_validator{1, 10}});
+        parser.add_option(input, sharg::config{.short_id = 'i', .validator = sharg::input_file_validator{{"fa"}}});
+        parser.add_positional_option(files, sharg::config{.validator = sharg::input_file_validator{{"fa"}}});
+
+        try
+        {
+            if (async_validation)
+            {
+                parser.enable_async_validation();
+                EXPECT_THROW(parser.wait_validated(), sharg::design_error);
+            }
+
+            parser.parse();
+
+            // The values are parsed before they are validated.
+            EXPECT_EQ(files.size(), 100u);
+
+            parser.wait_validated();
+        }
+        catch (sharg::validation_error const & error)
+        {
+            return error.what();
+        }
+
+        // Waiting again does not validate the values again.
+        EXPECT_NO_THROW(parser.wait_validated());
+        return {};
+    };
+
+    EXPECT_EQ(parse(true), "");
+
+    // The first error in parsing order is reported, as without asynchronous validation.
+    arguments[2] = "20";
+    arguments[4] = (directory / "missing.fa").string();
+    arguments[50] = (directory / "missing.fa").string();
+    EXPECT_EQ(parse(true), parse(false));
+    EXPECT_EQ(parse(true), "Validation failed for option -n: Value 20 is not in range [1,10].");
+
+    arguments[2] = "5";
+    EXPECT_EQ(parse(true), parse(false));
+    EXPECT_EQ(parse(true), "Validation failed for option -i: The file \"" + arguments[4] + "\" does not exist!");
+
+    arguments[4] = arguments[5];
+    EXPECT_EQ(parse(true), parse(false));
+    EXPECT_EQ(parse(true),
+              "Validation failed for positional option 101: The file \"" + arguments[50] + "\" does not exist!");
+
+    // The values must be parsed first.
+    sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+    parser.enable_async_validation();
+    EXPECT_THROW(parser.wait_validated(), sharg::design_error);
+}
+
+TEST_F(validator_test, async_validation_not_awaited)
+{
+    int number{};
+    std::vector<std::string> const arguments{"./test_parser", "-n", "20"};
+    std::string const message{"Validation failed for option -n: Value 20 is not in range [1,10]."};
+
+    auto add_option = [&number](sharg::parser & parser)
+    {
+        parser.enable_async_validation();
+        parser.add_option(number,
+                          sharg::config{.short_id = 'n', .validator = sharg::arithmetic_range_validator{1, 10}});
+    };
+
+    // Resetting the parser throws the error that was not awaited.
+    {
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        add_option(parser);
+        parser.parse();
+        EXPECT_THROW_MSG(parser.reset(), sharg::validation_error, message);
+        EXPECT_EQ(number, 0); // The parser was reset nonetheless.
+        EXPECT_NO_THROW(parser.reset());
+    }
+
+    // Parses the arguments and destroys the parser without waiting for the validation.
+    auto parse_without_waiting = [&arguments, &add_option](bool const application_throws)
+    {
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        add_option(parser);
+        parser.parse();
+
+        if (application_throws)
+            throw std::runtime_error{"The application failed."};
+    };
+
+    // If the application returns early, e.g. because of another error, the destructor reports the error and exits.
+    expect_exit(
+        [&parse_without_waiting]()
+        {
+            parse_without_waiting(false);
+        },
+        EXIT_FAILURE,
+        "did not call sharg::parser::wait_validated: Validation failed for option -n");
+
+    // If an exception is propagating, the error is only printed.
+    testing::internal::CaptureStderr();
+    EXPECT_THROW(parse_without_waiting(true), std::runtime_error);
+    EXPECT_NE(testing::internal::GetCapturedStderr().find(message), std::string::npos);
+
+    // The values may be modified or destroyed before the validation finished, e.g. if the application throws.
+    {
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        parser.enable_async_validation();
+        {
+            std::vector<int> numbers{};
+            parser.add_option(numbers,
+                              sharg::config{.short_id = 'n', .validator = sharg::arithmetic_range_validator{1, 10}});
+            parser.parse();
+            numbers.assign(1000u, 5);
+        }
+        EXPECT_THROW_MSG(parser.wait_validated(), sharg::validation_error, message);
+    }
+
+    // Errors that were awaited are not reported again.
+    {
+        sharg::parser parser{"test_parser", arguments, sharg::update_notifications::off};
+        add_option(parser);
+        parser.parse();
+        EXPECT_THROW(parser.wait_validated(), sharg::validation_error);
+        EXPECT_NO_THROW(parser.reset());
+    }
+}
+
+TEST_F(validator_test, syscall_count)
+{
+    sharg::test::tmp_filename const tmp_name{"input.fa"};
+    std::filesystem::path const input_path{tmp_name.get_path()};
+    std::filesystem::path const output_path{input_path.parent_path() / "output.fa"};
+    std::ofstream{input_path};
+
+    sharg::file_validator_base::reset_syscall_count();
+    EXPECT_EQ(sharg::file_validator_base::syscall_count(), 0u);
+
+    EXPECT_NO_THROW(sharg::input_file_validator{}(input_path));
+#ifndef _WIN32
+    EXPECT_EQ(sharg::input_file_validator::syscall_count(), 2u); // statx/stat and faccessat
+#endif
+
+    sharg::input_file_validator::reset_syscall_count();
+    EXPECT_NO_THROW(sharg::input_directory_validator{}(input_path.parent_path()));
+#ifndef _WIN32
+    EXPECT_EQ(sharg::file_validator_base::syscall_count(), 2u); // statx/stat and faccessat
+#endif
+
+    // The output file is not created.
+    sharg::input_file_validator::reset_syscall_count();
+    EXPECT_NO_THROW(sharg::output_file_validator{}(output_path));
+    EXPECT_FALSE(std::filesystem::exists(output_path));
+#ifndef _WIN32
+    EXPECT_LE(sharg::file_validator_base::syscall_count(), 4u); // statx/stat, open(O_TMPFILE) and close or faccessat
+#endif
+
+    sharg::input_file_validator::reset_syscall_count();
+    EXPECT_NO_THROW(sharg::output_file_validator{sharg::output_file_open_options::open_or_create}(input_path));
+#ifndef _WIN32
+    EXPECT_EQ(sharg::file_validator_base::syscall_count(), 2u); // statx/stat and faccessat
+#endif
+}
+
+TEST_F(validator_test, input_file_prefetch)
+{
+    sharg::test::tmp_filename const tmp{"prefetch"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+
+    std::vector<std::string> files{};
+    for (size_t i = 0; i < 3u; ++i)
+    {
+        files.push_back((directory / ("file_" + std::to_string(i) + ".fa")).string());
+        std::ofstream{files.back()} << std::string(600u, 'A');
+    }
+
+    // The files are prefetched until 1000 bytes were requested.
+    sharg::input_file_validator validator{{"fa"}};
+    validator.prefetch(sharg::prefetch_mode::willneed, 1000u);
+    sharg::input_file_validator const copy{validator};
+    std::vector<size_t> syscalls{};
+
+    for (auto const & current_validator : {validator, copy, validator})
+    {
+        sharg::file_validator_base::reset_syscall_count();
+        EXPECT_NO_THROW(current_validator(files[syscalls.size()]));
+        syscalls.push_back(sharg::file_validator_base::syscall_count());
+    }
+
+#ifdef __linux__
+    // statx and faccessat, and open, fstat, posix_fadvise and close for the prefetched files.
+    EXPECT_EQ(syscalls, (std::vector<size_t>{6u, 6u, 2u}));
+#endif
+
+    // Invalid files are not prefetched.
+    validator.prefetch(sharg::prefetch_mode::readahead);
+    sharg::file_validator_base::reset_syscall_count();
+    EXPECT_THROW(validator(directory / "file.bam"), sharg::validation_error);
+#ifndef _WIN32
+    EXPECT_EQ(sharg::file_validator_base::syscall_count(), 1u);
+#endif
+
+    std::vector<std::string> values{};
+    auto parser = get_parser(files[0], files[1], files[2]);
+    parser.add_positional_option(
+        values,
+        sharg::config{.validator = sharg::input_file_validator{{"fa"}}.prefetch(sharg::prefetch_mode::none)});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values, files);
+}
+
+TEST_F(validator_test, free_space_validator)
+{
+    sharg::test::tmp_filename const tmp{"space"};
+    std::filesystem::path const directory{tmp.get_path()};
+    std::filesystem::create_directory(directory);
+    std::filesystem::path const output{directory / "missing" / "output.txt"};
+    uint64_t const max = std::numeric_limits<uint64_t>::max();
+
+    EXPECT_NO_THROW(sharg::free_space_validator{}(output));
+    EXPECT_NO_THROW(sharg::free_space_validator{1024u}(output));
+    EXPECT_NO_THROW(sharg::free_space_validator{1024u}(std::vector<std::filesystem::path>{output, directory}));
+
+    // The nearest existing ancestor is checked.
+    std::string const expected = "Not enough free space for \"" + output.string()
+                               + "\": 18446744073709551615 bytes (15.9 EiB) required, but only ";
+    std::string message{};
+    try
+    {
+        sharg::free_space_validator{max}(output);
+    }
+    catch (sharg::validation_error const & error)
+    {
+        message = error.what();
+    }
+    EXPECT_EQ(message.substr(0, expected.size()), expected);
+    EXPECT_TRUE(message.ends_with(" available in \"" + directory.string() + "\"!")) << message;
+
+    if (sharg::detail::file_probe::space(directory).available_inodes.has_value())
+    {
+        EXPECT_THROW(sharg::free_space_validator(0u, max)(output), sharg::validation_error);
+    }
+
+    // The required bytes are computed on validation.
+    std::vector<std::filesystem::path> inputs{directory / "a.txt", directory / "b.txt", directory / "missing.txt"};
+    std::ofstream{inputs[0]} << std::string(1000u, 'A');
+    std::ofstream{inputs[1]} << std::string(24u, 'A');
+    EXPECT_EQ(sharg::free_space_validator::size_of(inputs), 1024u);
+
+    uint64_t factor{1u};
+    sharg::free_space_validator const validator{[&]()
+                                                {
+                                                    return factor * sharg::free_space_validator::size_of(inputs);
+                                                }};
+    EXPECT_NO_THROW(validator(output));
+    factor = max / 1024u;
+    EXPECT_THROW(validator(output), sharg::validation_error);
+
+    // Help page message.
+    EXPECT_EQ(validator.get_help_page_message(), "The file system must have enough free space for the output.");
+    EXPECT_EQ(sharg::free_space_validator{1u}.get_help_page_message(), "The file system must have 1 byte of free space.");
+    EXPECT_EQ(sharg::free_space_validator{1023u}.get_help_page_message(),
+              "The file system must have 1023 bytes of free space.");
+    EXPECT_EQ(sharg::free_space_validator{1610612736u}.reserve().get_help_page_message(),
+              "The file system must have 1610612736 bytes (1.5 GiB) of free space. The space is reserved on "
+              "validation.");
+
+    // Chained with an output file validator.
+    std::filesystem::path const output_file{directory / "output.txt"};
+    std::filesystem::path value{};
+    auto parser = get_parser("-o", output_file.string());
+    parser.add_option(value,
+                      sharg::config{.short_id = 'o',
+                                    .validator = sharg::output_file_validator{{"txt"}}
+                                               | sharg::free_space_validator{max / 2u}});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+}
+
+TEST_F(validator_test, free_space_validator_reserve)
+{
+    sharg::test::tmp_filename const tmp{"reserve"};
+    std::filesystem::path const output{tmp.get_path()};
+
+    sharg::free_space_validator validator{sharg::free_space_validator{1u << 20}.reserve()};
+    EXPECT_NO_THROW(validator(output));
+    EXPECT_NO_THROW(validator(output.parent_path())); // Directories are not modified.
+
+#ifdef __linux__
+    // The size of the file does not change, but the space is allocated, unless the file system does not support it.
+    ASSERT_TRUE(std::filesystem::exists(output));
+    EXPECT_EQ(std::filesystem::file_size(output), 0u);
+    struct stat status{};
+    ASSERT_EQ(::stat(output.c_str(), &status), 0);
+    EXPECT_GE(static_cast<uint64_t>(status.st_blocks) * 512u, 1u << 20);
+#endif
+
+    validator.reserve(false);
+    std::filesystem::remove(output);
+    EXPECT_NO_THROW(validator(output));
+    EXPECT_FALSE(std::filesystem::exists(output));
+}
+
 TEST_F(validator_test, inputfile_not_readable)
 {
     sharg::test::tmp_filename const tmp_name{"my_file.test"};
@@ -766,6 +1326,33 @@ TEST_F(validator_test, value_list_validator_success)
                                        "          desc Default: []. Value must be one of [-10, 48, 50].\n\n"
                                        + basic_options_str + '\n' + version_str());
     EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
+
+    // option - list separator
+    int_vector.clear();
+    parser = get_parser("-i", "-10,48", "-i", "50");
+    parser.add_option(int_vector,
+                      sharg::config{.short_id = 'i',
+                                    .list_separator = ',',
+                                    .validator = sharg::value_list_validator<int>{-10, 48, 50}});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(int_vector, (std::vector<int>{-10, 48, 50}));
+
+    // get help page message - list separator
+    int_vector.clear();
+    parser = get_parser("-h");
+    parser.add_option(int_vector,
+                      sharg::config{.short_id = 'i',
+                                    .description = "desc",
+                                    .list_separator = ',',
+                                    .validator = sharg::value_list_validator<int>{-10, 48, 50}});
+    expected = std::string("test_parser\n"
+                           "===========\n"
+                           "\nOPTIONS\n"
+                           "    -i (List of signed 32 bit integer)\n"
+                           "          desc Default: []. Multiple values can be separated by ','. Value\n"
+                           "          must be one of [-10, 48, 50].\n\n"
+                           + basic_options_str + '\n' + version_str());
+    EXPECT_EQ(get_parse_cout_on_exit(parser), expected);
 }
 
 TEST_F(validator_test, value_list_validator_error)
@@ -828,6 +1415,81 @@ TEST_F(validator_test, value_list_validator_issue178)
     EXPECT_EQ(vector[1], "ba");
 }
 
+TEST_F(validator_test, value_list_validator_large)
+{
+    std::vector<std::string> contigs{};
+    for (size_t i = 0; i < 1000u; ++i)
+        contigs.push_back("chr" + std::to_string(i));
+
+    sharg::value_list_validator const validator{contigs};
+    EXPECT_NO_THROW(validator("chr0"));
+    EXPECT_NO_THROW(validator("chr999"));
+    EXPECT_NO_THROW(validator(std::vector<std::string>{"chr5", "chr500"}));
+    EXPECT_THROW(validator("chr1000"), sharg::validation_error);
+    EXPECT_THROW(validator(""), sharg::validation_error);
+
+    // Copies share the valid values and the hash table.
+    sharg::value_list_validator<std::string> copy{};
+    copy = validator;
+    EXPECT_NO_THROW(copy("chr42"));
+    EXPECT_THROW(copy("chrX"), sharg::validation_error);
+
+    std::string const listed{"[chr0, chr1, chr2, chr3, chr4, chr5, chr6, chr7, chr8, chr9, chr10, chr11, chr12, chr13, "
+                             "chr14, chr15, chr16, chr17, chr18, chr19, ...] (1000 values)"};
+    EXPECT_EQ(validator.get_help_page_message(), "Value must be one of " + listed + ".");
+    EXPECT_THROW_MSG(validator("chrX"), sharg::validation_error, "Value chrX is not one of " + listed + ".");
+
+    // Integers that are multiples of a large power of two.
+    std::vector<int64_t> offsets{};
+    for (int64_t i = -100; i < 100; ++i)
+        offsets.push_back(i << 32);
+
+    sharg::value_list_validator const offset_validator{offsets};
+    EXPECT_NO_THROW(offset_validator(int64_t{-100} << 32));
+    EXPECT_NO_THROW(offset_validator(int64_t{99} << 32));
+    EXPECT_THROW(offset_validator(1), sharg::validation_error);
+    EXPECT_THROW(offset_validator(int64_t{100} << 32), sharg::validation_error);
+}
+
+TEST_F(validator_test, value_list_validator_from_file)
+{
+    sharg::test::tmp_filename const fai{"ref.fa.fai"};
+    std::ofstream{fai.get_path()} << "chr1\t248956422\t112\t70\t71\n"
+                                     "chr2\t242193529\t252513167\t70\t71\r\n"
+                                     "\n"
+                                     "chrM\t16569\t3099684009\t70\t71";
+
+    auto validator = sharg::value_list_validator<std::string>::from_file(fai.get_path());
+    EXPECT_EQ(validator.get_help_page_message(), "Value must be one of [chr1, chr2, chrM].");
+
+    std::string value{};
+    auto parser = get_parser("-c", "chrM");
+    parser.add_option(value, sharg::config{.short_id = 'c', .validator = validator});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, "chrM");
+
+    parser = get_parser("-c", "248956422");
+    parser.add_option(value, sharg::config{.short_id = 'c', .validator = validator});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+
+    // A plain list.
+    sharg::test::tmp_filename const list{"names.txt"};
+    std::ofstream{list.get_path()} << "first name\nsecond name\n";
+    validator = sharg::value_list_validator<std::string>::from_file(list.get_path());
+    EXPECT_NO_THROW(validator("second name"));
+    EXPECT_THROW(validator("second"), sharg::validation_error);
+
+    // An empty file.
+    sharg::test::tmp_filename const empty{"empty.txt"};
+    std::ofstream{empty.get_path()};
+    EXPECT_THROW(sharg::value_list_validator<std::string>::from_file(empty.get_path())("a"), sharg::validation_error);
+
+    sharg::test::tmp_filename const missing{"missing.txt"};
+    EXPECT_THROW_MSG(sharg::value_list_validator<std::string>::from_file(missing.get_path()),
+                     sharg::user_input_error,
+                     "The value list file " + missing.get_path().string() + " could not be read.");
+}
+
 TEST_F(validator_test, regex_validator_success)
 {
     std::string value{};
@@ -925,6 +1587,48 @@ TEST_F(validator_test, regex_validator_error)
     EXPECT_EQ(vector[1], "tt");
 }
 
+TEST_F(validator_test, regex_validator_fallback)
+{
+    // Back-references are not supported by the automaton; std::regex is used instead.
+    sharg::regex_validator repeat_validator{"(ab)\\1"};
+    EXPECT_NO_THROW(repeat_validator("abab"));
+    EXPECT_THROW(repeat_validator("abba"), sharg::validation_error);
+
+    // Invalid patterns are detected on construction.
+    EXPECT_THROW(sharg::regex_validator{"(ab"}, std::regex_error);
+}
+
+TEST_F(validator_test, static_regex_validator)
+{
+    std::string value{};
+    std::vector<std::string> vector{};
+    sharg::static_regex_validator<"[a-zA-Z]+@[a-zA-Z]+\\.com"> email_validator{};
+
+    EXPECT_NO_THROW(email_validator("ballo@rollo.com"));
+    EXPECT_NO_THROW(email_validator(std::vector<std::string>{"rita@rambo.com", "tina@rambo.com"}));
+    EXPECT_THROW(email_validator("ballo@rollo.de"), sharg::validation_error);
+    EXPECT_EQ(email_validator.get_help_page_message(), "Value must match the pattern '[a-zA-Z]+@[a-zA-Z]+\\.com'.");
+
+    // option
+    auto parser = get_parser("-s", "ballo@rollo.com");
+    parser.add_option(value, sharg::config{.short_id = 's', .validator = email_validator});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, "ballo@rollo.com");
+
+    // positional option - vector
+    parser = get_parser("rollo", "bttllo", "lollo");
+    parser.add_positional_option(vector, sharg::config{.validator = sharg::static_regex_validator<".*oll.*">{}});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+
+    // chained
+    parser = get_parser("chr1");
+    parser.add_positional_option(
+        value,
+        sharg::config{.validator = sharg::static_regex_validator<"chr.*">{} | sharg::regex_validator{".*[0-9]"}});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, "chr1");
+}
+
 TEST_F(validator_test, chaining_validators_common_type)
 {
     // chaining integral options stay integral
@@ -1110,3 +1814,150 @@ TEST_F(validator_test, chaining_validators)
     EXPECT_EQ(option_vector.size(), 1u);
     EXPECT_EQ(option_vector[0], tmp_string);
 }
+
+// Records the order in which the validators are called.
+template <sharg::validator_cost cost_>
+struct recording_validator
+{
+    using option_value_type = int;
+
+    static constexpr sharg::validator_cost cost{cost_};
+
+    std::string name{};
+    std::vector<std::string> * calls{};
+    bool accepts{true};
+
+    void operator()(int const) const
+    {
+        calls->push_back(name);
+
+        if (!accepts)
+            throw sharg::validation_error{name + " rejects."};
+    }
+
+    std::string get_help_page_message() const
+    {
+        return name + ".";
+    }
+};
+
+TEST_F(validator_test, validator_cost)
+{
+    using sharg::validator_cost;
+
+    EXPECT_EQ(sharg::validator_cost_v<sharg::arithmetic_range_validator<int>>, validator_cost::cheap);
+    EXPECT_EQ(sharg::validator_cost_v<sharg::value_list_validator<int>>, validator_cost::cheap);
+    EXPECT_EQ(sharg::validator_cost_v<sharg::regex_validator>, validator_cost::cpu);
+    EXPECT_EQ(sharg::validator_cost_v<sharg::input_file_validator const &>, validator_cost::io);
+    EXPECT_EQ(sharg::validator_cost_v<sharg::free_space_validator>, validator_cost::io);
+    EXPECT_EQ(sharg::validator_cost_v<hanging_validator>, validator_cost::cpu); // No cost given.
+
+    auto chain = sharg::arithmetic_range_validator{1, 10} | sharg::value_list_validator{1, 2};
+    EXPECT_EQ(sharg::validator_cost_v<decltype(chain)>, validator_cost::cheap);
+    EXPECT_EQ(sharg::validator_cost_v<decltype(sharg::regex_validator{".*"} | sharg::input_file_validator{})>,
+              validator_cost::io);
+    EXPECT_EQ(sharg::validator_cost_v<decltype(sharg::any_of(chain, recording_validator<validator_cost::cpu>{}))>,
+              validator_cost::cpu);
+}
+
+TEST_F(validator_test, chaining_validators_by_cost)
+{
+    using sharg::validator_cost;
+    using sharg::operator|; // Not found by ADL for recording_validator.
+
+    std::vector<std::string> calls{};
+    recording_validator<validator_cost::io> a{"a", &calls};
+    recording_validator<validator_cost::cpu> b{"b", &calls};
+    recording_validator<validator_cost::cheap> c{"c", &calls};
+    recording_validator<validator_cost::cheap> d{"d", &calls};
+
+    // The pipe operator calls the validators from left to right.
+    EXPECT_NO_THROW((a | b | c | d)(0));
+    EXPECT_EQ(calls, (std::vector<std::string>{"a", "b", "c", "d"}));
+
+    // sharg::all_of calls them ordered by cost; equal costs keep the given order, including nested sharg::all_of.
+    calls.clear();
+    EXPECT_NO_THROW(sharg::all_of(a, b, c, d)(0));
+    EXPECT_EQ(calls, (std::vector<std::string>{"c", "d", "b", "a"}));
+
+    calls.clear();
+    EXPECT_NO_THROW(sharg::all_of(a, sharg::all_of(d, b), c)(0));
+    EXPECT_EQ(calls, (std::vector<std::string>{"d", "c", "b", "a"}));
+
+    // A chain is called as a whole, in the position of its most expensive validator.
+    calls.clear();
+    EXPECT_NO_THROW(sharg::all_of(a, d | b, c)(0));
+    EXPECT_EQ(calls, (std::vector<std::string>{"c", "d", "b", "a"}));
+
+    // The pipe operator reports the first validator that rejects the value.
+    calls.clear();
+    b.accepts = false;
+    d.accepts = false;
+    EXPECT_THROW_MSG((a | b | c | d)(0), sharg::validation_error, "b rejects.");
+    EXPECT_EQ(calls, (std::vector<std::string>{"a", "b"}));
+
+    // sharg::all_of reports the cheapest validator that rejects the value; more expensive ones are not called.
+    calls.clear();
+    EXPECT_THROW_MSG(sharg::all_of(a, d, b, c)(0), sharg::validation_error, "d rejects.");
+    EXPECT_EQ(calls, (std::vector<std::string>{"d"}));
+
+    // The help page message keeps the written order.
+    EXPECT_EQ((a | b | c).get_help_page_message(), "a. b. c.");
+    EXPECT_EQ(sharg::all_of(a, b, c).get_help_page_message(), "a. b. c.");
+
+    // A value that does not match the pattern is rejected without accessing the file system.
+    sharg::file_validator_base::reset_syscall_count();
+    EXPECT_THROW_MSG(sharg::all_of(sharg::input_file_validator{}, sharg::regex_validator{".*\\.fa"})("missing.txt"),
+                     sharg::validation_error,
+                     "Value missing.txt did not match the pattern .*\\.fa.");
+    EXPECT_EQ(sharg::file_validator_base::syscall_count(), 0u);
+
+    // The pipe operator validates the file first.
+    EXPECT_THROW_MSG((sharg::input_file_validator{} | sharg::regex_validator{".*\\.fa"})("missing.txt"),
+                     sharg::validation_error,
+                     "The file \"missing.txt\" does not exist!");
+}
+
+TEST_F(validator_test, any_of)
+{
+    using sharg::validator_cost;
+
+    std::vector<std::string> calls{};
+    recording_validator<validator_cost::io> a{"a", &calls, false};
+    recording_validator<validator_cost::cheap> b{"b", &calls, false};
+    recording_validator<validator_cost::cpu> c{"c", &calls};
+
+    // The cheap alternatives are tried first.
+    EXPECT_NO_THROW(sharg::any_of(a, b, c)(0));
+    EXPECT_EQ(calls, (std::vector<std::string>{"b", "c"}));
+
+    // The errors are listed in the given order.
+    calls.clear();
+    c.accepts = false;
+    EXPECT_THROW_MSG(sharg::any_of(a, b, c)(0),
+                     sharg::validation_error,
+                     "None of the alternatives accepts the value: (1) a rejects. (2) b rejects. (3) c rejects.");
+    EXPECT_EQ(calls, (std::vector<std::string>{"b", "c", "a"}));
+
+    EXPECT_EQ(sharg::any_of(a, b, c).get_help_page_message(), "One of the following must hold: (1) a. (2) b. (3) c.");
+
+    // Within a parser.
+    int value{};
+    auto parser = get_parser("-i", "42");
+    parser.add_option(value,
+                      sharg::config{.short_id = 'i',
+                                    .validator = sharg::any_of(sharg::arithmetic_range_validator{1, 10},
+                                                               sharg::value_list_validator{42, 43})});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, 42);
+
+    parser = get_parser("-i", "20");
+    parser.add_option(value,
+                      sharg::config{.short_id = 'i',
+                                    .validator = sharg::any_of(sharg::arithmetic_range_validator{1, 10},
+                                                               sharg::value_list_validator{42, 43})});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option -i: None of the alternatives accepts the value: (1) Value 20 is not "
+                     "in range [1,10]. (2) Value 20 is not one of [42, 43].");
+}
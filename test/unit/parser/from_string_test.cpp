@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+namespace foo
+{
+
+// Only parsable via the ADL overload of from_string.
+struct interval
+{
+    int begin{};
+    int end{};
+
+    friend std::ostream & operator<<(std::ostream & os, interval const & value)
+    {
+        return os << value.begin << '-' << value.end;
+    }
+};
+
+interval from_string(interval, std::string_view const str)
+{
+    size_t const dash = str.find('-');
+
+    if (dash == std::string_view::npos)
+        throw std::invalid_argument{"Missing '-'."};
+
+    interval result{};
+    std::from_chars(str.data(), str.data() + dash, result.begin);
+    std::from_chars(str.data() + dash + 1, str.data() + str.size(), result.end);
+
+    if (result.end < result.begin)
+        throw sharg::user_input_error{"The interval " + std::string{str} + " is empty."};
+
+    return result;
+}
+
+// Has both a stream operator and a from_string customisation.
+struct counted
+{
+    std::string value{};
+    bool used_from_string{false};
+
+    friend std::istream & operator>>(std::istream & is, counted & value)
+    {
+        return is >> value.value;
+    }
+
+    friend std::ostream & operator<<(std::ostream & os, counted const & value)
+    {
+        return os << value.value;
+    }
+};
+
+// Constructible from a std::string_view, but parsed via its stream operator.
+struct streamed
+{
+    std::string value{};
+
+    streamed() = default;
+
+    explicit streamed(std::string_view const str) : value{"constructed from " + std::string{str}}
+    {}
+
+    friend std::istream & operator>>(std::istream & is, streamed & value)
+    {
+        return is >> value.value;
+    }
+
+    friend std::ostream & operator<<(std::ostream & os, streamed const & value)
+    {
+        return os << value.value;
+    }
+};
+
+} // namespace foo
+
+namespace sharg::custom
+{
+
+template <>
+struct parsing<foo::counted>
+{
+    static foo::counted from_string(std::string_view const str)
+    {
+        return foo::counted{std::string{str}, true};
+    }
+};
+
+} // namespace sharg::custom
+
+static_assert(sharg::from_string_parsable<foo::interval>);
+static_assert(sharg::from_string_parsable<foo::counted>);
+static_assert(!sharg::from_string_parsable<int>);
+static_assert(sharg::parsable<foo::interval>);
+static_assert(!sharg::istreamable<foo::interval>);
+
+class from_string_test : public sharg::test::test_fixture
+{};
+
+TEST_F(from_string_test, adl)
+{
+    foo::interval value{};
+
+    auto parser = get_parser("-i", "3-7");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value.begin, 3);
+    EXPECT_EQ(value.end, 7);
+}
+
+TEST_F(from_string_test, custom_parsing_preferred_over_stream)
+{
+    foo::counted value{};
+    std::vector<foo::counted> values{};
+
+    auto parser = get_parser("-c", "value with spaces");
+    parser.add_option(value, sharg::config{.short_id = 'c'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value.value, "value with spaces");
+    EXPECT_TRUE(value.used_from_string);
+
+    parser = get_parser("a", "b");
+    parser.add_positional_option(values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    ASSERT_EQ(values.size(), 2u);
+    EXPECT_EQ(values[1].value, "b");
+    EXPECT_TRUE(values[1].used_from_string);
+}
+
+TEST_F(from_string_test, parse_error)
+{
+    foo::interval value{};
+
+    // std::exception -> generic parse error
+    auto parser = get_parser("-i", "3");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for -i: Argument 3 could not be parsed as type foo::interval.");
+
+    // sharg::parser_error -> forwarded
+    parser = get_parser("-i", "7-3");
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    EXPECT_THROW_MSG(parser.parse(), sharg::user_input_error, "The interval 7-3 is empty.");
+}
+
+TEST_F(from_string_test, path)
+{
+    std::filesystem::path value{};
+
+    // no std::quoted semantics, i.e. whitespace is part of the path
+    auto parser = get_parser("-p", "my dir/file.txt");
+    parser.add_option(value, sharg::config{.short_id = 'p'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, std::filesystem::path{"my dir/file.txt"});
+
+    // quotes are part of the path as well
+    parser = get_parser("-p", "\"quoted\"");
+    parser.add_option(value, sharg::config{.short_id = 'p'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, std::filesystem::path{"\"quoted\""});
+}
+
+TEST_F(from_string_test, stream_operator_preferred_over_string_view_constructor)
+{
+    foo::streamed value{};
+
+    auto parser = get_parser("-s", "value");
+    parser.add_option(value, sharg::config{.short_id = 's'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value.value, "value");
+}
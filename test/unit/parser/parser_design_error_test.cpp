@@ -228,6 +228,41 @@ TEST_F(verify_default_message_config_test, flag_set)
                  sharg::design_error);
 }
 
+// -----------------------------------------------------------------------------
+// list_separator config verification
+// -----------------------------------------------------------------------------
+
+class verify_list_separator_config_test : public sharg::test::test_fixture
+{};
+
+TEST_F(verify_list_separator_config_test, no_container_option)
+{
+    int option_value{};
+    std::vector<int> list_value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW(parser.add_option(option_value, sharg::config{.short_id = 'i', .list_separator = ','}),
+                 sharg::design_error);
+    EXPECT_NO_THROW(parser.add_option(list_value, sharg::config{.short_id = 'j', .list_separator = ','}));
+}
+
+TEST_F(verify_list_separator_config_test, positional_option_set)
+{
+    std::vector<int> option_value{};
+
+    auto parser = get_parser("arg1");
+    EXPECT_THROW(parser.add_positional_option(option_value, sharg::config{.list_separator = ','}),
+                 sharg::design_error);
+}
+
+TEST_F(verify_list_separator_config_test, flag_set)
+{
+    bool value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW(parser.add_flag(value, sharg::config{.short_id = 'i', .list_separator = ','}), sharg::design_error);
+}
+
 // -----------------------------------------------------------------------------
 // general
 // -----------------------------------------------------------------------------
@@ -302,6 +337,9 @@ TEST_F(design_error_test, not_allowed_after_parse)
     EXPECT_THROW_MSG(parser.add_flag(flag, sharg::config{.short_id = 'i'}),
                      sharg::design_error,
                      "add_flag may only be used before calling parse().");
+    EXPECT_THROW_MSG(parser.enable_response_files(),
+                     sharg::design_error,
+                     "enable_response_files may only be used before calling parse().");
     EXPECT_THROW_MSG(parser.add_positional_option(value, sharg::config{}),
                      sharg::design_error,
                      "add_positional_option may only be used before calling parse().");
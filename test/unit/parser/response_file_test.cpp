@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class response_file_test : public sharg::test::test_fixture
+{
+protected:
+    sharg::test::tmp_filename const tmp{"args.txt"};
+
+    // Writes `content` to a file next to `tmp` and returns `@path`.
+    std::string write_response_file(std::string const & name, std::string const & content) const
+    {
+        std::filesystem::path const path = tmp.get_path().parent_path() / name;
+        std::ofstream{path} << content;
+        return "@" + path.string();
+    }
+
+    static std::vector<std::string> tokenize(std::string content, sharg::response_file_syntax const syntax)
+    {
+        std::vector<std::string> tokens{};
+        sharg::detail::tokenize_response_file(content.data(),
+                                              content.data() + content.size(),
+                                              syntax,
+                                              [&tokens](std::string_view const token)
+                                              {
+                                                  tokens.emplace_back(token);
+                                              });
+        return tokens;
+    }
+};
+
+TEST_F(response_file_test, tokenize_gnu)
+{
+    using strings = std::vector<std::string>;
+    constexpr auto gnu = sharg::response_file_syntax::gnu;
+
+    EXPECT_EQ(tokenize("", gnu), strings{});
+    EXPECT_EQ(tokenize(" \n\t\r\n", gnu), strings{});
+    EXPECT_EQ(tokenize("-i 3\r\n--name=x  file\n", gnu), (strings{"-i", "3", "--name=x", "file"}));
+    EXPECT_EQ(tokenize("'a b' \"c d\" e\\ f", gnu), (strings{"a b", "c d", "e f"}));
+    EXPECT_EQ(tokenize("'it''s' \"say \\\"hi\\\"\" 'x\"y'", gnu), (strings{"its", "say \"hi\"", "x\"y"}));
+    EXPECT_EQ(tokenize("'' a\"\"b \\\\ end\\", gnu), (strings{"", "ab", "\\", "end"}));
+    EXPECT_EQ(tokenize("'unterminated quote", gnu), (strings{"unterminated quote"}));
+}
+
+TEST_F(response_file_test, tokenize_windows)
+{
+    using strings = std::vector<std::string>;
+    constexpr auto windows = sharg::response_file_syntax::windows;
+
+    EXPECT_EQ(tokenize("-i 3\r\n\"a b\" c:\\dir\\file", windows), (strings{"-i", "3", "a b", "c:\\dir\\file"}));
+    EXPECT_EQ(tokenize("'a b'", windows), (strings{"'a", "b'"}));
+    EXPECT_EQ(tokenize("a\\\"b \"a\"\"b\" \"\"", windows), (strings{"a\"b", "a\"b", ""}));
+    EXPECT_EQ(tokenize("\"c:\\dir\\\\\" \\\\\\\"x\"", windows), (strings{"c:\\dir\\", "\\\"x"}));
+}
+
+TEST_F(response_file_test, tokenize_in_place)
+{
+    std::string content{"plain 'quoted arg'"};
+    std::vector<std::string_view> tokens{};
+    sharg::detail::tokenize_response_file(content.data(),
+                                          content.data() + content.size(),
+                                          sharg::response_file_syntax::gnu,
+                                          [&tokens](std::string_view const token)
+                                          {
+                                              tokens.push_back(token);
+                                          });
+
+    ASSERT_EQ(tokens.size(), 2u);
+    EXPECT_EQ(tokens[0].data(), content.data()); // unquoted arguments are views into the content
+    EXPECT_EQ(tokens[1].data(), content.data() + 6u);
+    EXPECT_EQ(tokens[1], "quoted arg");
+    EXPECT_TRUE(content.starts_with("plain quoted arg"));
+}
+
+TEST_F(response_file_test, expand)
+{
+    int value{};
+    std::vector<std::string> files{};
+
+    std::string const inner = write_response_file("inner.txt", "b.txt 'c d.txt'\n");
+    std::string const outer = write_response_file("outer.txt", "-i 3\n" + inner + "\n@does_not_exist");
+
+    auto parser = get_parser(outer, "e.txt", "--", outer);
+    parser.enable_response_files();
+    parser.add_option(value, sharg::config{.short_id = 'i'});
+    parser.add_positional_option(files, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, 3);
+    EXPECT_EQ(files, (std::vector<std::string>{"b.txt", "c d.txt", "@does_not_exist", "e.txt", outer}));
+}
+
+TEST_F(response_file_test, disabled_by_default)
+{
+    std::vector<std::string> files{};
+    std::string const response_file = write_response_file("args.txt", "a b");
+
+    auto parser = get_parser(response_file);
+    parser.add_positional_option(files, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(files, (std::vector<std::string>{response_file}));
+}
+
+TEST_F(response_file_test, empty_file)
+{
+    std::vector<std::string> files{};
+    std::string const response_file = write_response_file("empty.txt", "");
+
+    auto parser = get_parser(response_file, "a");
+    parser.enable_response_files(sharg::response_file_syntax::windows);
+    parser.add_positional_option(files, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(files, (std::vector<std::string>{"a"}));
+}
+
+TEST_F(response_file_test, recursion)
+{
+    std::vector<std::string> files{};
+    std::string const first = "@" + (tmp.get_path().parent_path() / "first.txt").string();
+    std::string const second = write_response_file("second.txt", "a " + first);
+    write_response_file("first.txt", "b " + second);
+
+    auto parser = get_parser(first);
+    parser.enable_response_files();
+    parser.add_positional_option(files, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "The response file " + first.substr(1) + " includes itself.");
+
+    // The same file may be used several times if it does not include itself.
+    std::string const leaf = write_response_file("leaf.txt", "b");
+    std::string const twice = write_response_file("twice.txt", leaf + " a " + leaf);
+
+    parser = get_parser(twice, leaf);
+    parser.enable_response_files();
+    parser.add_positional_option(files, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(files, (std::vector<std::string>{"b", "a", "b", "b"}));
+}
+
+TEST_F(response_file_test, subcommand)
+{
+    int value{};
+    std::string const response_file = write_response_file("args.txt", "build -i 3");
+
+    auto top_level_parser = get_subcommand_parser({response_file}, {"build"});
+    top_level_parser.enable_response_files();
+    EXPECT_NO_THROW(top_level_parser.parse());
+
+    auto & sub_parser = top_level_parser.get_sub_parser();
+    sub_parser.add_option(value, sharg::config{.short_id = 'i'});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(value, 3);
+}
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class reusable_parser_test : public sharg::test::test_fixture
+{
+protected:
+    using arguments_t = std::vector<std::string_view>;
+
+    int value{7};
+    bool flag{false};
+    std::vector<std::string> positional{"default"};
+    std::ostringstream stream{};
+
+    sharg::parser parser{get_parser()};
+
+    void SetUp() override
+    {
+        parser.add_option(value, sharg::config{.short_id = 'i'});
+        parser.add_flag(flag, sharg::config{.short_id = 'f'});
+        parser.add_positional_option(positional, sharg::config{});
+    }
+};
+
+TEST_F(reusable_parser_test, parse_many_times)
+{
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-i", "3", "-f", "a", "b"}, stream),
+              sharg::parse_outcome::parsed);
+    EXPECT_EQ(value, 3);
+    EXPECT_TRUE(flag);
+    EXPECT_EQ(positional, (std::vector<std::string>{"a", "b"}));
+    EXPECT_TRUE(parser.is_option_set('i'));
+
+    // Values that are not given are reset to the values they had when they were added.
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "c"}, stream), sharg::parse_outcome::parsed);
+    EXPECT_EQ(value, 7);
+    EXPECT_FALSE(flag);
+    EXPECT_EQ(positional, (std::vector<std::string>{"c"}));
+    EXPECT_FALSE(parser.is_option_set('i'));
+
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-i", "4", "d", "e"}, stream), sharg::parse_outcome::parsed);
+    EXPECT_EQ(value, 4);
+    EXPECT_EQ(positional, (std::vector<std::string>{"d", "e"}));
+
+    EXPECT_TRUE(stream.str().empty());
+}
+
+TEST_F(reusable_parser_test, errors)
+{
+    EXPECT_THROW(parser.parse(arguments_t{"./test_parser", "-i", "x", "a"}, stream), sharg::user_input_error);
+    EXPECT_THROW(parser.parse(arguments_t{"./test_parser", "-g", "a"}, stream), sharg::unknown_option);
+    EXPECT_THROW(parser.parse(arguments_t{"./test_parser", "-i", "5"}, stream), sharg::too_few_arguments);
+
+    // The parser can be used after an error.
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-i", "5", "a"}, stream), sharg::parse_outcome::parsed);
+    EXPECT_EQ(value, 5);
+
+    EXPECT_THROW_MSG(parser.parse(arguments_t{}, stream),
+                     sharg::design_error,
+                     "The arguments must contain at least the name of the executable.");
+
+    // The legacy overload may only be called once.
+    EXPECT_THROW(parser.parse(), sharg::design_error);
+    EXPECT_THROW(parser.add_option(value, sharg::config{.short_id = 'j'}), sharg::design_error);
+}
+
+TEST_F(reusable_parser_test, special_formats)
+{
+    parser.info.short_copyright = "short copyright";
+
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser"}, stream), sharg::parse_outcome::help_printed);
+    EXPECT_EQ(stream.str(), "test_parser\n===========\n    Try -h or --help for more information.\n");
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-h"}, stream), sharg::parse_outcome::help_printed);
+    EXPECT_NE(stream.str().find("-i (signed 32 bit integer)\n          Default: 7\n"), std::string::npos);
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-hh"}, stream), sharg::parse_outcome::help_printed);
+    EXPECT_NE(stream.str().find("POSITIONAL ARGUMENTS"), std::string::npos);
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--version"}, stream), sharg::parse_outcome::version_printed);
+    EXPECT_EQ(stream.str(), "test_parser\n===========\n\n" + version_str());
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--copyright"}, stream),
+              sharg::parse_outcome::copyright_printed);
+    EXPECT_NE(stream.str().find("short copyright"), std::string::npos);
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--export-help", "html"}, stream),
+              sharg::parse_outcome::help_exported);
+    EXPECT_TRUE(stream.str().starts_with("<!DOCTYPE html"));
+
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--export-help=man"}, stream),
+              sharg::parse_outcome::help_exported);
+    EXPECT_TRUE(stream.str().starts_with(".TH TEST_PARSER"));
+
+    // The help page shows the reset default value.
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-i", "3", "a"}, stream), sharg::parse_outcome::parsed);
+    stream.str("");
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--help"}, stream), sharg::parse_outcome::help_printed);
+    EXPECT_NE(stream.str().find("Default: 7\n"), std::string::npos);
+}
+
+TEST_F(reusable_parser_test, reset)
+{
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "-i", "3", "a"}, stream), sharg::parse_outcome::parsed);
+    parser.reset();
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(positional, (std::vector<std::string>{"default"}));
+
+    // Options can be added after reset().
+    std::string name{};
+    parser.add_option(name, sharg::config{.long_id = "name"});
+    EXPECT_EQ(parser.parse(arguments_t{"./test_parser", "--name", "x", "b"}, stream), sharg::parse_outcome::parsed);
+    EXPECT_EQ(name, "x");
+    EXPECT_EQ(positional, (std::vector<std::string>{"b"}));
+}
+
+TEST_F(reusable_parser_test, subcommands)
+{
+    sharg::parser top_level_parser{get_subcommand_parser({}, {"build", "search"})};
+    int threads{};
+
+    for (std::string_view const subcommand : {"build", "search", "build"})
+    {
+        EXPECT_EQ(top_level_parser.parse(arguments_t{"./test_parser", subcommand, "-t", "2"}, stream),
+                  sharg::parse_outcome::parsed);
+
+        sharg::parser & sub_parser = top_level_parser.get_sub_parser();
+        sub_parser.add_option(threads, sharg::config{.short_id = 't'});
+        EXPECT_EQ(sub_parser.parse(stream), sharg::parse_outcome::parsed);
+        EXPECT_EQ(threads, 2);
+        EXPECT_EQ(sharg::detail::test_accessor::executable_name(sub_parser),
+                  (std::vector<std::string>{"./test_parser", std::string{subcommand}}));
+
+        // A sub-parser can also be reused.
+        EXPECT_EQ(sub_parser.parse(arguments_t{subcommand, "-t", "3"}, stream), sharg::parse_outcome::parsed);
+        EXPECT_EQ(threads, 3);
+        EXPECT_EQ(sharg::detail::test_accessor::executable_name(sub_parser),
+                  (std::vector<std::string>{"./test_parser", std::string{subcommand}}));
+    }
+
+    EXPECT_EQ(top_level_parser.parse(arguments_t{"./test_parser", "--help"}, stream),
+              sharg::parse_outcome::help_printed);
+    EXPECT_THROW(top_level_parser.get_sub_parser(), sharg::design_error);
+}
+
+TEST_F(reusable_parser_test, subcommand_help)
+{
+    sharg::parser top_level_parser{get_subcommand_parser({}, {"build"})};
+    int threads{};
+
+    for (int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(top_level_parser.parse(arguments_t{"./test_parser", "build", "--help"}, stream),
+                  sharg::parse_outcome::parsed);
+
+        sharg::parser & sub_parser = top_level_parser.get_sub_parser();
+        sub_parser.add_option(threads, sharg::config{.short_id = 't', .description = "The threads."});
+
+        // The sub-parser returns instead of calling std::exit.
+        EXPECT_EQ(sub_parser.parse(stream), sharg::parse_outcome::help_printed);
+        EXPECT_NE(stream.str().find("test_parser-build"), std::string::npos);
+        EXPECT_NE(stream.str().find("The threads."), std::string::npos);
+        stream.str("");
+
+        // The stored arguments can be parsed again.
+        EXPECT_EQ(sub_parser.parse(stream), sharg::parse_outcome::help_printed);
+        stream.str("");
+    }
+
+    // Without arguments, there is nothing to parse.
+    sharg::parser empty_parser{"test_parser", std::vector<std::string>{}, sharg::update_notifications::off};
+    EXPECT_THROW(empty_parser.parse(stream), sharg::design_error);
+}
@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: 2006-2024, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2024, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#define SHARG_FAST_FROM_CHARS 1
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bit>
+#include <clocale>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <sharg/parser.hpp>
+#include <sharg/std/charconv>
+#include <sharg/test/test_fixture.hpp>
+
+template <typename T>
+class from_chars_fast_test : public ::testing::Test
+{
+public:
+    // Parses the whole string and expects success.
+    static T parse(std::string_view const str)
+    {
+        T value{};
+        auto res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+        EXPECT_EQ(res.ec, std::errc{}) << str;
+        EXPECT_EQ(res.ptr, str.data() + str.size()) << str;
+        return value;
+    }
+};
+
+using float_types = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(from_chars_fast_test, float_types, );
+
+TYPED_TEST(from_chars_fast_test, decimal_numbers)
+{
+    EXPECT_EQ(this->parse("1234"), TypeParam{1234});
+    EXPECT_EQ(this->parse("1.2e3"), TypeParam{1200});
+    EXPECT_EQ(this->parse("1.2E+3"), TypeParam{1200});
+    EXPECT_EQ(this->parse("1.2e-3"), static_cast<TypeParam>(0.0012L));
+    EXPECT_EQ(this->parse("1.e2"), TypeParam{100});
+    EXPECT_EQ(this->parse("1."), TypeParam{1});
+    EXPECT_EQ(this->parse(".25"), TypeParam{0.25});
+    EXPECT_EQ(this->parse("-0.1"), static_cast<TypeParam>(-0.1L));
+    EXPECT_EQ(this->parse("0.3"), static_cast<TypeParam>(0.3L));
+    EXPECT_EQ(this->parse("0000000000000000000000000000000001.5"), TypeParam{1.5});
+    EXPECT_EQ(this->parse("0e999999"), TypeParam{0});
+    EXPECT_TRUE(std::signbit(this->parse("-0")));
+}
+
+TYPED_TEST(from_chars_fast_test, correct_rounding)
+{
+    if constexpr (std::same_as<TypeParam, double>)
+    {
+        // 2^53 + 1 is exactly halfway between two doubles: ties to even.
+        EXPECT_EQ(this->parse("9007199254740993"), 9007199254740992.0);
+        // Digits after the 19th decide the rounding.
+        EXPECT_EQ(this->parse("9007199254740993.0000000000000000000001"), 9007199254740994.0);
+        EXPECT_EQ(this->parse("9007199254740992.9999999999999999999999"), 9007199254740992.0);
+        EXPECT_EQ(this->parse("1.7976931348623157e308"), std::numeric_limits<double>::max());
+        EXPECT_EQ(this->parse("2.2250738585072014e-308"), std::numeric_limits<double>::min());
+        EXPECT_EQ(this->parse("4.9406564584124654e-324"), std::numeric_limits<double>::denorm_min());
+        EXPECT_EQ(this->parse("1e23"), 1e23);
+        EXPECT_EQ(this->parse("0.30000000000000004"), 0.1 + 0.2);
+    }
+    else
+    {
+        // 2^24 + 1 is exactly halfway between two floats: ties to even.
+        EXPECT_EQ(this->parse("16777217"), 16777216.0f);
+        EXPECT_EQ(this->parse("16777217.000000000000000000001"), 16777218.0f);
+        EXPECT_EQ(this->parse("3.4028235e38"), std::numeric_limits<float>::max());
+        EXPECT_EQ(this->parse("1.4e-45"), std::numeric_limits<float>::denorm_min());
+        EXPECT_EQ(this->parse("1.00000005960464477550"), 1.0000001f);
+    }
+}
+
+TYPED_TEST(from_chars_fast_test, round_trip)
+{
+    using bits_type = std::conditional_t<std::same_as<TypeParam, float>, uint32_t, uint64_t>;
+    std::mt19937_64 rng{42u};
+
+    for (size_t i = 0; i < 10'000u; ++i)
+    {
+        TypeParam const expected = std::bit_cast<TypeParam>(static_cast<bits_type>(rng()));
+
+        if (!std::isfinite(expected))
+            continue;
+
+        std::array<char, 64> buffer{};
+        int const size = std::snprintf(buffer.data(),
+                                       buffer.size(),
+                                       "%.*g",
+                                       std::numeric_limits<TypeParam>::max_digits10,
+                                       static_cast<double>(expected));
+
+        EXPECT_EQ(this->parse(std::string_view{buffer.data(), static_cast<size_t>(size)}), expected) << buffer.data();
+    }
+}
+
+TYPED_TEST(from_chars_fast_test, partial_match)
+{
+    std::string_view const str{"1.5e+3x"};
+    TypeParam value{};
+    auto res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, str.data() + 6);
+    EXPECT_EQ(value, TypeParam{1500});
+
+    // An incomplete exponent is not part of the number.
+    for (std::string_view const incomplete : {"-.5e", "-.5e+", "-.5ex"})
+    {
+        res = sharg::contrib::charconv_float::from_chars_fast(incomplete.data(),
+                                                              incomplete.data() + incomplete.size(),
+                                                              value);
+        EXPECT_EQ(res.ec, std::errc{});
+        EXPECT_EQ(res.ptr, incomplete.data() + 3);
+        EXPECT_EQ(value, TypeParam{-0.5});
+    }
+}
+
+TYPED_TEST(from_chars_fast_test, chars_format)
+{
+    using sharg::contrib::charconv_float::from_chars_fast;
+    std::string_view const str{"1e5"};
+    TypeParam value{};
+
+    auto res = from_chars_fast(str.data(), str.data() + 3, value, std::chars_format::fixed);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, str.data() + 1);
+    EXPECT_EQ(value, TypeParam{1});
+
+    res = from_chars_fast(str.data(), str.data() + 3, value, std::chars_format::scientific);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(value, TypeParam{1e5});
+
+    value = TypeParam{42};
+    res = from_chars_fast(str.data(), str.data() + 1, value, std::chars_format::scientific);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+    EXPECT_EQ(res.ptr, str.data());
+    EXPECT_EQ(value, TypeParam{42});
+
+    res = from_chars_fast(str.data(), str.data() + 3, value, std::chars_format::hex);
+    EXPECT_EQ(res.ec, std::errc::invalid_argument);
+}
+
+TYPED_TEST(from_chars_fast_test, infinity_and_nan)
+{
+    EXPECT_EQ(this->parse("inf"), std::numeric_limits<TypeParam>::infinity());
+    EXPECT_EQ(this->parse("-INFINITY"), -std::numeric_limits<TypeParam>::infinity());
+    EXPECT_TRUE(std::isnan(this->parse("nan")));
+    EXPECT_TRUE(std::isnan(this->parse("NaN(abc_1)")));
+
+    // An unterminated n-char-sequence is not part of the number.
+    std::string_view const str{"nan(abc"};
+    TypeParam value{};
+    auto res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+    EXPECT_EQ(res.ec, std::errc{});
+    EXPECT_EQ(res.ptr, str.data() + 3);
+}
+
+TYPED_TEST(from_chars_fast_test, invalid_and_out_of_range)
+{
+    for (std::string_view const str : {"", "-", "+1", " 1", ".", "-.", "e5", "0x1p3"})
+    {
+        TypeParam value{42};
+        auto res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+        EXPECT_EQ(res.ec, str == "0x1p3" ? std::errc{} : std::errc::invalid_argument) << str;
+        EXPECT_EQ(value, str == "0x1p3" ? TypeParam{0} : TypeParam{42}) << str;
+    }
+
+    for (std::string_view const str : {"1e400", "-1e400", "1e-400", "1e99999999999999999999", "3.5e38", "1e-46"})
+    {
+        if (std::same_as<TypeParam, double> && (str == "3.5e38" || str == "1e-46"))
+            continue;
+
+        TypeParam value{42};
+        auto res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), value);
+        EXPECT_EQ(res.ec, std::errc::result_out_of_range) << str;
+        EXPECT_EQ(res.ptr, str.data() + str.size()) << str;
+        EXPECT_EQ(value, TypeParam{42}) << str;
+    }
+}
+
+TYPED_TEST(from_chars_fast_test, locale_independent)
+{
+    char const * const previous = std::setlocale(LC_NUMERIC, nullptr);
+    std::string const previous_locale{previous ? previous : "C"};
+
+    if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr)
+        GTEST_SKIP() << "Locale de_DE.UTF-8 is not available.";
+
+    EXPECT_EQ(this->parse("1.5"), TypeParam{1.5});
+    std::setlocale(LC_NUMERIC, previous_locale.c_str());
+}
+
+#if __cpp_lib_to_chars >= 201611
+TYPED_TEST(from_chars_fast_test, same_as_std)
+{
+    std::mt19937_64 rng{7u};
+    std::string str{};
+
+    for (size_t i = 0; i < 10'000u; ++i)
+    {
+        // Up to 40 digits and exponents beyond the range of TypeParam.
+        str = std::to_string(rng() % 1000u) + "." + std::to_string(rng()) + std::to_string(rng()) + "e"
+            + std::to_string(static_cast<int>(rng() % 800u) - 400);
+
+        TypeParam expected{};
+        TypeParam actual{};
+        auto expected_res = std::from_chars(str.data(), str.data() + str.size(), expected);
+        auto actual_res = sharg::contrib::charconv_float::from_chars_fast(str.data(), str.data() + str.size(), actual);
+
+        EXPECT_EQ(actual_res.ec, expected_res.ec) << str;
+        EXPECT_EQ(actual_res.ptr, expected_res.ptr) << str;
+        EXPECT_EQ(actual, expected) << str;
+    }
+}
+#endif
+
+class fast_from_chars_parser_test : public sharg::test::test_fixture
+{};
+
+TEST_F(fast_from_chars_parser_test, parse)
+{
+    double value{};
+    std::vector<float> values{};
+
+    auto parser = get_parser("-d", "0.30000000000000004", "1.5", "2e-3");
+    parser.add_option(value, sharg::config{.short_id = 'd'});
+    parser.add_positional_option(values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, 0.1 + 0.2);
+    EXPECT_EQ(values, (std::vector<float>{1.5f, 2e-3f}));
+
+    parser = get_parser("-d", "1e400");
+    parser.add_option(value, sharg::config{.short_id = 'd'});
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+
+    parser = get_parser("-d", "1,5");
+    parser.add_option(value, sharg::config{.short_id = 'd'});
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+}